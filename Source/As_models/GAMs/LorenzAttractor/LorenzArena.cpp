@@ -0,0 +1,254 @@
+/**
+ * @file LorenzArena.cpp
+ * @brief Source file for class LorenzArena
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This source file contains the definition of all the methods for
+ * the class LorenzArena (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "MemoryOperationsHelper.h"
+#include "LorenzArena.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * Alignment of the blocks (cache line).
+ */
+const MARTe::uint64 BlockAlignment = 64u;
+
+/**
+ * Huge page size.
+ */
+const MARTe::uint64 HugePageSize = 0x200000u;
+
+/**
+ * Smallest page size, used to fault in the region.
+ */
+const MARTe::uint64 PageSize = 0x1000u;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LorenzArena::LorenzArena() {
+    numberOfBlocks = 0u;
+    size = 0u;
+    memory = NULL_PTR(uint8 *);
+    mapped = false;
+    hugePageBacked = false;
+    locked = false;
+    pageSize = PageSize;
+}
+
+LorenzArena::~LorenzArena() {
+    Free();
+}
+
+bool LorenzArena::Reserve(const uint32 numberOfComponents, const uint32 numberOfItems, const uint32 elementSize, const bool partitioned,
+                          uint32 &block) {
+    bool ok = ((memory == NULL_PTR(uint8 *)) && (numberOfBlocks < MaximumNumberOfBlocks));
+    if (ok) {
+        block = numberOfBlocks;
+        blocks[block].offset = size;
+        blocks[block].numberOfComponents = numberOfComponents;
+        blocks[block].numberOfItems = numberOfItems;
+        blocks[block].elementSize = elementSize;
+        blocks[block].partitioned = partitioned;
+        numberOfBlocks++;
+        const uint64 bytes = static_cast<uint64>(numberOfComponents) * static_cast<uint64>(numberOfItems) * static_cast<uint64>(elementSize);
+        size += ((bytes + BlockAlignment - 1u) / BlockAlignment) * BlockAlignment;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Cannot reserve more than %u blocks, nor after the allocation", MaximumNumberOfBlocks);
+    }
+    return ok;
+}
+
+bool LorenzArena::Allocate(const bool hugePages) {
+    bool ok = (memory == NULL_PTR(uint8 *));
+    if ((ok) && (size == 0u)) {
+        // Nothing reserved: keep a valid (empty) region anyway
+        size = BlockAlignment;
+    }
+#ifdef __linux__
+    if (ok) {
+        void *region = MAP_FAILED;
+        if (hugePages) {
+            size = ((size + HugePageSize - 1u) / HugePageSize) * HugePageSize;
+            region = mmap(NULL_PTR(void *), static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            hugePageBacked = (region != MAP_FAILED);
+        }
+        else {
+            size = ((size + PageSize - 1u) / PageSize) * PageSize;
+        }
+        if ((region == MAP_FAILED) && (hugePages)) {
+            // No pool of explicit huge pages: map one more huge page, keep the aligned part and ask for transparent huge pages
+            // (best effort), so that the huge pages, and thus the placement of the partitions, follow the offsets in the region
+            void *unaligned = mmap(NULL_PTR(void *), static_cast<size_t>(size + HugePageSize), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                                   -1, 0);
+            if (unaligned != MAP_FAILED) {
+                const uintp address = reinterpret_cast<uintp>(unaligned);
+                const uintp aligned = ((address + HugePageSize - 1u) / HugePageSize) * HugePageSize;
+                const uintp head = aligned - address;
+                if (head > 0u) {
+                    (void) munmap(unaligned, static_cast<size_t>(head));
+                }
+                (void) munmap(reinterpret_cast<void *>(aligned + size), static_cast<size_t>(HugePageSize - head));
+                region = reinterpret_cast<void *>(aligned);
+                (void) madvise(region, static_cast<size_t>(size), MADV_HUGEPAGE);
+            }
+        }
+        if (region == MAP_FAILED) {
+            region = mmap(NULL_PTR(void *), static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        }
+        ok = (region != MAP_FAILED);
+        if (ok) {
+            memory = static_cast<uint8 *>(region);
+            mapped = true;
+            // Explicit or transparent, a huge page is placed as a whole by the first thread touching it
+            const bool hugeAligned = ((reinterpret_cast<uintp>(region) % HugePageSize) == 0u);
+            pageSize = ((hugePages) && (hugeAligned)) ? (HugePageSize) : (PageSize);
+        }
+    }
+#else
+    if (ok) {
+        (void) hugePages;
+        memory = new uint8[size];
+        mapped = false;
+        pageSize = PageSize;
+        (void) MemoryOperationsHelper::Set(memory, '\0', static_cast<uint32>(size));
+    }
+#endif
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to allocate %u bytes", size);
+    }
+    return ok;
+}
+
+void *LorenzArena::GetBlock(const uint32 block) const {
+    return &memory[blocks[block].offset];
+}
+
+void LorenzArena::Touch(const uint32 partition, const uint32 begin, const uint32 end) {
+    uint32 b;
+    for (b = 0u; b < numberOfBlocks; b++) {
+        const Block &block = blocks[b];
+        uint32 firstComponent = 0u;
+        uint32 lastComponent = block.numberOfComponents;
+        uint32 firstItem = begin;
+        uint32 lastItem = (end < block.numberOfItems) ? (end) : (block.numberOfItems);
+        if (block.partitioned) {
+            firstComponent = partition;
+            lastComponent = (partition < block.numberOfComponents) ? (partition + 1u) : (0u);
+            firstItem = 0u;
+            lastItem = block.numberOfItems;
+        }
+        uint32 c;
+        for (c = firstComponent; (c < lastComponent) && (firstItem < lastItem); c++) {
+            const uint64 component = block.offset + (static_cast<uint64>(c) * block.numberOfItems * block.elementSize);
+            // A page belongs to the items which hold its first byte, so that the partitions never share a page
+            const uint64 firstPage = (((component + (static_cast<uint64>(firstItem) * block.elementSize)) + pageSize - 1u) / pageSize) * pageSize;
+            const uint64 lastByte = component + (static_cast<uint64>(lastItem) * block.elementSize);
+            // Write back the value read, so that the content is preserved
+            volatile uint8 *page = memory;
+            uint64 offset;
+            for (offset = firstPage; offset < lastByte; offset += pageSize) {
+                page[offset] = page[offset];
+            }
+        }
+    }
+}
+
+void LorenzArena::Prefault(const bool lock) {
+    // Write back the value read, so that the pages already touched keep their content
+    volatile uint8 *page = memory;
+    uint64 offset;
+    for (offset = 0u; offset < size; offset += PageSize) {
+        page[offset] = page[offset];
+    }
+#ifdef __linux__
+    if (lock) {
+        locked = (mlock(memory, static_cast<size_t>(size)) == 0);
+        if (!locked) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed to lock %u bytes in memory (see RLIMIT_MEMLOCK)", size);
+        }
+    }
+#else
+    (void) lock;
+#endif
+}
+
+void LorenzArena::Free() {
+#ifdef __linux__
+    if (mapped) {
+        if (locked) {
+            (void) munlock(memory, static_cast<size_t>(size));
+        }
+        (void) munmap(memory, static_cast<size_t>(size));
+    }
+#endif
+    if (!mapped) {
+        delete[] memory;
+    }
+    memory = NULL_PTR(uint8 *);
+    mapped = false;
+    hugePageBacked = false;
+    locked = false;
+    pageSize = PageSize;
+    numberOfBlocks = 0u;
+    size = 0u;
+}
+
+uint64 LorenzArena::GetSize() const {
+    return size;
+}
+
+bool LorenzArena::IsHugePageBacked() const {
+    return hugePageBacked;
+}
+
+bool LorenzArena::IsLocked() const {
+    return locked;
+}
+
+}
@@ -0,0 +1,199 @@
+/**
+ * @file LorenzArena.h
+ * @brief Header file for class LorenzArena
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This header file contains the declaration of the class
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef LORENZARENA_H_
+#define LORENZARENA_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief A single memory region which holds all the arrays of a model, allocated once and never resized.
+ * @details The arrays are first reserved, then the region is allocated in one go (2 MB pages where available:
+ * explicit huge pages if the system has a pool of them, transparent huge pages otherwise) and the pointers are
+ * obtained with GetBlock(). The memory is zeroed but not touched by Allocate():
+ *  - Touch(partition, begin, end), called by the thread which will process the items [begin, end), faults in the
+ *    pages of these items in every block (and of the component \a partition of the partitioned blocks), so that
+ *    they are placed (first touch) on the NUMA node of that thread. A page (2 MB if huge pages were requested)
+ *    belongs to the items holding its first byte: the boundary pages are never claimed by two partitions;
+ *  - Prefault() faults in the remaining pages and optionally locks the whole region in memory, so that the
+ *    real-time code never takes a page fault.
+ *
+ * Each block holds numberOfComponents arrays of numberOfItems elements (structure of arrays, as the state of the
+ * models) and starts on a cache line. The components of a partitioned block are owned by one partition each
+ * (e.g. per-thread scratch buffers).
+ */
+class LorenzArena {
+public:
+
+    /**
+     * Maximum number of blocks.
+     */
+    static const uint32 MaximumNumberOfBlocks = 32u;
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LorenzArena();
+
+    /**
+     * @brief Destructor. Calls Free().
+     */
+    ~LorenzArena();
+
+    /**
+     * @brief Reserves a block of \a numberOfComponents x \a numberOfItems elements of \a elementSize bytes.
+     * @param[in] partitioned if true, component k belongs to partition k (see Touch()).
+     * @param[out] block the index of the block (see GetBlock()).
+     * @return false if the region is already allocated or MaximumNumberOfBlocks were reserved.
+     */
+    bool Reserve(const uint32 numberOfComponents, const uint32 numberOfItems, const uint32 elementSize, const bool partitioned, uint32 &block);
+
+    /**
+     * @brief Allocates the region for all the reserved blocks.
+     * @param[in] hugePages if true, the region is backed by 2 MB pages where available.
+     * @return true if the region could be allocated.
+     */
+    bool Allocate(const bool hugePages);
+
+    /**
+     * @brief Gets the first element of \a block.
+     * @pre Allocate() && block < number of reserved blocks.
+     */
+    void *GetBlock(const uint32 block) const;
+
+    /**
+     * @brief Faults in (without changing their content) the pages of the items [begin, end) of all the components
+     * of the blocks which are not partitioned and of the component \a partition of the partitioned blocks.
+     * @details May be called concurrently by several threads on disjoint partitions.
+     * @pre Allocate().
+     */
+    void Touch(const uint32 partition, const uint32 begin, const uint32 end);
+
+    /**
+     * @brief Faults in all the pages of the region (without changing its content) and optionally locks them.
+     * @param[in] lock if true the region is locked in memory. Failing to lock it (e.g. because of RLIMIT_MEMLOCK)
+     * is reported as a warning, the region remains prefaulted.
+     * @pre Allocate().
+     */
+    void Prefault(const bool lock);
+
+    /**
+     * @brief Releases the region and forgets the blocks.
+     */
+    void Free();
+
+    /**
+     * @brief Gets the size of the region in bytes.
+     */
+    uint64 GetSize() const;
+
+    /**
+     * @brief Returns true if the region is backed by explicit huge pages.
+     */
+    bool IsHugePageBacked() const;
+
+    /**
+     * @brief Returns true if the region is locked in memory.
+     */
+    bool IsLocked() const;
+
+private:
+
+    /**
+     * @brief A reserved block.
+     */
+    struct Block {
+        uint64 offset;
+        uint32 numberOfComponents;
+        uint32 numberOfItems;
+        uint32 elementSize;
+        bool partitioned;
+    };
+
+    /**
+     * The reserved blocks.
+     */
+    Block blocks[MaximumNumberOfBlocks];
+
+    /**
+     * Number of reserved blocks.
+     */
+    uint32 numberOfBlocks;
+
+    /**
+     * Size of the region (a multiple of the page size once allocated).
+     */
+    uint64 size;
+
+    /**
+     * The region.
+     */
+    uint8 *memory;
+
+    /**
+     * True if memory was mapped (rather than allocated from the heap).
+     */
+    bool mapped;
+
+    /**
+     * True if memory is backed by explicit huge pages.
+     */
+    bool hugePageBacked;
+
+    /**
+     * True if memory is locked.
+     */
+    bool locked;
+
+    /**
+     * Granularity of the placement of the pages on the NUMA nodes (memory is aligned on it).
+     */
+    uint64 pageSize;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LORENZARENA_H_ */
@@ -0,0 +1,269 @@
+/**
+ * @file LorenzArrayFile.cpp
+ * @brief Source file for class LorenzArrayFile
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This source file contains the definition of all the methods for
+ * the class LorenzArrayFile (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "BasicFile.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
+#include "LorenzArrayFile.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LorenzArrayFile::LorenzArrayFile() {
+    memory = NULL_PTR(const uint8 *);
+    size = 0u;
+    mapped = false;
+}
+
+LorenzArrayFile::~LorenzArrayFile() {
+    Close();
+}
+
+bool LorenzArrayFile::Open(const char8 * const fileName) {
+    Close();
+    bool ok = true;
+#ifdef __linux__
+    const int32 descriptor = open(fileName, O_RDONLY);
+    ok = (descriptor >= 0);
+    struct stat status;
+    if (ok) {
+        ok = ((fstat(descriptor, &status) == 0) && (status.st_size > 0));
+    }
+    if (ok) {
+        size = static_cast<uint64>(status.st_size);
+        void * const region = mmap(NULL_PTR(void *), static_cast<size_t>(size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ok = (region != MAP_FAILED);
+        if (ok) {
+            memory = static_cast<const uint8 *>(region);
+            mapped = true;
+        }
+    }
+    if (descriptor >= 0) {
+        (void) close(descriptor);
+    }
+#else
+    BasicFile file;
+    ok = file.Open(fileName, BasicFile::ACCESS_MODE_R);
+    if (ok) {
+        size = file.Size();
+        ok = ((size > 0u) && (size < 0x100000000ull));
+    }
+    if (ok) {
+        uint8 * const buffer = new uint8[size];
+        memory = buffer;
+        uint32 readSize = static_cast<uint32>(size);
+        ok = ((file.Read(reinterpret_cast<char8 *>(buffer), readSize)) && (readSize == static_cast<uint32>(size)));
+    }
+    if (file.IsOpen()) {
+        (void) file.Close();
+    }
+#endif
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Could not map %s", fileName);
+    }
+    const Header *header = reinterpret_cast<const Header *>(memory);
+    if (ok) {
+        ok = (size >= sizeof(Header));
+    }
+    if (ok) {
+        ok = ((header->magic[0] == 'L') && (header->magic[1] == 'Z') && (header->magic[2] == 'A') && (header->magic[3] == 'F') && (header->version == 1u));
+    }
+    if (ok) {
+        uint64 expected = sizeof(Header) + (static_cast<uint64>(header->numberOfFields) * sizeof(FieldDescriptor));
+        ok = (size >= expected);
+        const FieldDescriptor *descriptors = reinterpret_cast<const FieldDescriptor *>(&memory[sizeof(Header)]);
+        uint32 f;
+        for (f = 0u; (f < header->numberOfFields) && (ok); f++) {
+            ok = (GetElementSize(descriptors[f].type) > 0u);
+            expected += GetArraySize(descriptors[f].type, header->numberOfRecords);
+        }
+        if (ok) {
+            ok = (size >= expected);
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s is truncated or has unknown field types", fileName);
+        }
+    }
+    else {
+        if (memory != NULL_PTR(const uint8 *)) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "%s is not a LorenzArrayFile (version 1)", fileName);
+        }
+    }
+    if (!ok) {
+        Close();
+    }
+    return ok;
+}
+
+uint32 LorenzArrayFile::GetNumberOfRecords() const {
+    return reinterpret_cast<const Header *>(memory)->numberOfRecords;
+}
+
+const void *LorenzArrayFile::GetField(const char8 * const name, uint32 &type) const {
+    const Header *header = reinterpret_cast<const Header *>(memory);
+    const FieldDescriptor *descriptors = reinterpret_cast<const FieldDescriptor *>(&memory[sizeof(Header)]);
+    uint64 offset = sizeof(Header) + (static_cast<uint64>(header->numberOfFields) * sizeof(FieldDescriptor));
+    const void *field = NULL_PTR(const void *);
+    uint32 f;
+    for (f = 0u; (f < header->numberOfFields) && (field == NULL_PTR(const void *)); f++) {
+        // The name may fill the 16 characters in a file not written by Write()
+        char8 fieldName[sizeof(descriptors[f].name) + 1u];
+        (void) MemoryOperationsHelper::Copy(&fieldName[0], &descriptors[f].name[0], static_cast<uint32>(sizeof(descriptors[f].name)));
+        fieldName[sizeof(descriptors[f].name)] = '\0';
+        if (StringHelper::Compare(&fieldName[0], name) == 0) {
+            field = &memory[offset];
+            type = descriptors[f].type;
+        }
+        offset += GetArraySize(descriptors[f].type, header->numberOfRecords);
+    }
+    return field;
+}
+
+void LorenzArrayFile::Close() {
+#ifdef __linux__
+    if (mapped) {
+        (void) munmap(const_cast<uint8 *>(memory), static_cast<size_t>(size));
+    }
+#endif
+    if (!mapped) {
+        delete[] memory;
+    }
+    memory = NULL_PTR(const uint8 *);
+    size = 0u;
+    mapped = false;
+}
+
+uint32 LorenzArrayFile::GetElementSize(const uint32 type) {
+    uint32 size = 0u;
+    if (type == static_cast<uint32>(Float64Field)) {
+        size = static_cast<uint32>(sizeof(float64));
+    }
+    else if (type == static_cast<uint32>(Float32Field)) {
+        size = static_cast<uint32>(sizeof(float32));
+    }
+    else if (type == static_cast<uint32>(UnsignedInteger32Field)) {
+        size = static_cast<uint32>(sizeof(uint32));
+    }
+    else {
+        size = 0u;
+    }
+    return size;
+}
+
+uint64 LorenzArrayFile::GetArraySize(const uint32 type, const uint32 numberOfRecords) {
+    const uint64 size = static_cast<uint64>(GetElementSize(type)) * static_cast<uint64>(numberOfRecords);
+    return (size + 7u) & ~static_cast<uint64>(7u);
+}
+
+bool LorenzArrayFile::Write(const char8 * const fileName, const uint32 numberOfRecords, const uint32 numberOfFields, const char8 * const * const names,
+                            const uint32 * const types, const void * const * const arrays) {
+    BasicFile file;
+    bool ok = file.Open(fileName, BasicFile::FLAG_CREAT | BasicFile::FLAG_TRUNC | BasicFile::ACCESS_MODE_W);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Could not open %s", fileName);
+    }
+    Header header;
+    header.magic[0] = 'L';
+    header.magic[1] = 'Z';
+    header.magic[2] = 'A';
+    header.magic[3] = 'F';
+    header.version = 1u;
+    header.numberOfRecords = numberOfRecords;
+    header.numberOfFields = numberOfFields;
+    if (ok) {
+        uint32 size = static_cast<uint32>(sizeof(Header));
+        ok = file.Write(reinterpret_cast<const char8 *>(&header), size);
+    }
+    uint32 f;
+    for (f = 0u; (f < numberOfFields) && (ok); f++) {
+        FieldDescriptor descriptor;
+        ok = MemoryOperationsHelper::Set(&descriptor, '\0', static_cast<uint32>(sizeof(FieldDescriptor)));
+        if (ok) {
+            ok = ((StringHelper::Length(names[f]) < sizeof(descriptor.name)) && (GetElementSize(types[f]) > 0u));
+        }
+        if (ok) {
+            ok = StringHelper::Copy(&descriptor.name[0], names[f]);
+        }
+        if (ok) {
+            descriptor.type = types[f];
+            uint32 size = static_cast<uint32>(sizeof(FieldDescriptor));
+            ok = file.Write(reinterpret_cast<const char8 *>(&descriptor), size);
+        }
+    }
+    for (f = 0u; (f < numberOfFields) && (ok); f++) {
+        // Written in chunks as BasicFile::Write takes a 32 bit size
+        const char8 *data = static_cast<const char8 *>(arrays[f]);
+        uint64 remaining = static_cast<uint64>(GetElementSize(types[f])) * static_cast<uint64>(numberOfRecords);
+        const uint64 padding = GetArraySize(types[f], numberOfRecords) - remaining;
+        while ((remaining > 0u) && (ok)) {
+            uint32 size = (remaining > 0x40000000u) ? (0x40000000u) : (static_cast<uint32>(remaining));
+            const uint32 chunk = size;
+            ok = file.Write(data, size);
+            data = &data[chunk];
+            remaining -= chunk;
+        }
+        if ((padding > 0u) && (ok)) {
+            const char8 zeros[8] = { '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0' };
+            uint32 size = static_cast<uint32>(padding);
+            ok = file.Write(&zeros[0], size);
+        }
+    }
+    if (file.IsOpen()) {
+        if (!file.Close()) {
+            ok = false;
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::OSError, "Failed to write %s", fileName);
+    }
+    return ok;
+}
+
+}
@@ -0,0 +1,181 @@
+/**
+ * @file LorenzArrayFile.h
+ * @brief Header file for class LorenzArrayFile
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This header file contains the declaration of the class
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LORENZARRAYFILE_H_
+#define LORENZARRAYFILE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Compact binary file of named typed arrays with the same number of records, used for the
+ * parameter sweep results and the bulk initial conditions.
+ * @details The layout (host byte order) is:
+ *  - the Header (16 bytes);
+ *  - numberOfFields FieldDescriptor (24 bytes each);
+ *  - the arrays, in the order of the descriptors, each with numberOfRecords elements and padded to a multiple of 8 bytes.
+ *
+ * As the arrays are stored one after the other (structure-of-arrays) a field can be copied, or memory mapped,
+ * straight into the state arrays.
+ *
+ * The files are written with the static Write() and read with an instance: Open() maps the whole file
+ * (read-only) and GetField() returns the address of an array in the mapping, valid until Close().
+ */
+class LorenzArrayFile {
+public:
+
+    /**
+     * @brief Type of the elements of a field.
+     */
+    enum FieldType {
+        Float64Field = 0,
+        Float32Field = 1,
+        UnsignedInteger32Field = 2
+    };
+
+    /**
+     * @brief File header.
+     */
+    struct Header {
+        /** "LZAF" */
+        char8 magic[4];
+        /** Version of the layout (1). */
+        uint32 version;
+        /** Number of elements of each array. */
+        uint32 numberOfRecords;
+        /** Number of arrays. */
+        uint32 numberOfFields;
+    };
+
+    /**
+     * @brief Description of an array.
+     */
+    struct FieldDescriptor {
+        /** Zero terminated name. */
+        char8 name[16];
+        /** A FieldType. */
+        uint32 type;
+        /** Zero. */
+        uint32 reserved;
+    };
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LorenzArrayFile();
+
+    /**
+     * @brief Destructor. Calls Close().
+     */
+    ~LorenzArrayFile();
+
+    /**
+     * @brief Maps a file and validates its header and descriptors.
+     * @return true if the file could be mapped and its size matches the descriptors.
+     */
+    bool Open(const char8 * const fileName);
+
+    /**
+     * @brief Gets the number of elements of each array.
+     * @pre Open().
+     */
+    uint32 GetNumberOfRecords() const;
+
+    /**
+     * @brief Gets the array named \a name.
+     * @param[out] type the FieldType of the array.
+     * @return the address of the first element (in the mapping), or NULL if there is no such array.
+     * @pre Open().
+     */
+    const void *GetField(const char8 * const name, uint32 &type) const;
+
+    /**
+     * @brief Unmaps the file.
+     */
+    void Close();
+
+    /**
+     * @brief Gets the size of an element of the given type (0 if unknown).
+     */
+    static uint32 GetElementSize(const uint32 type);
+
+    /**
+     * @brief Gets the size in the file of an array, including the padding.
+     */
+    static uint64 GetArraySize(const uint32 type, const uint32 numberOfRecords);
+
+    /**
+     * @brief Writes the arrays to a new file (replacing any existing one).
+     * @param[in] fileName the path of the file.
+     * @param[in] numberOfRecords the number of elements of each array.
+     * @param[in] numberOfFields the number of arrays.
+     * @param[in] names the name of each array (at most 15 characters).
+     * @param[in] types the FieldType of each array.
+     * @param[in] arrays the address of each array.
+     * @return true if the file could be written.
+     */
+    static bool Write(const char8 * const fileName, const uint32 numberOfRecords, const uint32 numberOfFields, const char8 * const * const names,
+                      const uint32 * const types, const void * const * const arrays);
+
+private:
+
+    /**
+     * The file content.
+     */
+    const uint8 *memory;
+
+    /**
+     * Size of the file.
+     */
+    uint64 size;
+
+    /**
+     * True if memory is a mapping (rather than a heap copy).
+     */
+    bool mapped;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LORENZARRAYFILE_H_ */
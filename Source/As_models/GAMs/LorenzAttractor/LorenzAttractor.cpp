@@ -29,19 +29,62 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#include <math.h>
+
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "CLASSMETHODREGISTER.h"
+#include "MemoryOperationsHelper.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "Sleep.h"
+#include "Vector.h"
 #include "LorenzAttractor.h"
+#include "LorenzRandom.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+
+/**
+ * @brief Returns true if the signal is written by the model (and thus needs no Default).
+ */
+bool IsModelOutput(const MARTe::StreamString &signalName) {
+    const MARTe::char8 * const modelOutputs[] = { "Time", "NumberOfNodes", "Lyapunov", "SweepProgress", "SweepState", "EventCount", "EventTimes", "EventNodes", "EventTypes", NULL_PTR(const MARTe::char8 *) };
+    bool found = false;
+    MARTe::uint32 i;
+    for (i = 0u; (modelOutputs[i] != NULL_PTR(const MARTe::char8 *)) && (!found); i++) {
+        found = (signalName == modelOutputs[i]);
+    }
+    return found;
+}
+
+/**
+ * @brief Copies the state of the nodes [begin, end) to a float64 output signal, in the configured node order.
+ */
+template<typename T>
+void CopyState(const T * const source, MARTe::float64 * const destination, const MARTe::uint32 * const permutation, const MARTe::uint32 begin,
+               const MARTe::uint32 end) {
+    MARTe::uint32 i;
+    if (permutation != NULL_PTR(const MARTe::uint32 *)) {
+        for (i = begin; i < end; i++) {
+            destination[permutation[i]] = static_cast<MARTe::float64>(source[i]);
+        }
+    }
+    else {
+        for (i = begin; i < end; i++) {
+            destination[i] = static_cast<MARTe::float64>(source[i]);
+        }
+    }
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -50,11 +93,412 @@ namespace MARTe {
 
 LorenzAttractor::LorenzAttractor() :
         GAM(), MessageI() {
-
+    modelEnabled = false;
+    parameters.sigma = 10.0;
+    parameters.rho = 28.0;
+    parameters.beta = 8.0 / 3.0;
+    timeStep = 0.0;
+    numberOfSubSteps = 1u;
+    tableau = LorenzKernels::RungeKutta4;
+    numberOfNodes = 0u;
+    outputState[0] = NULL_PTR(float64 *);
+    outputState[1] = NULL_PTR(float64 *);
+    outputState[2] = NULL_PTR(float64 *);
+    maximumNumberOfNodes = 0u;
+    stateBuffers[0] = NULL_PTR(float64 *);
+    stateBuffers[1] = NULL_PTR(float64 *);
+    stateBuffers[2] = NULL_PTR(float64 *);
+    state = NULL_PTR(float64 *);
+    stageBuffer[0] = NULL_PTR(float64 *);
+    stageBuffer[1] = NULL_PTR(float64 *);
+    accumulator = NULL_PTR(float64 *);
+    singlePrecision = false;
+    compensated = false;
+    stateBuffers32[0] = NULL_PTR(float32 *);
+    stateBuffers32[1] = NULL_PTR(float32 *);
+    stateBuffers32[2] = NULL_PTR(float32 *);
+    state32 = NULL_PTR(float32 *);
+    stageBuffer32[0] = NULL_PTR(float32 *);
+    stageBuffer32[1] = NULL_PTR(float32 *);
+    accumulator32 = NULL_PTR(float32 *);
+    compensation = NULL_PTR(float32 *);
+    initialState = NULL_PTR(float64 *);
+    pendingState = 0;
+    pending.numberOfNodes = 0u;
+    pending.timeStep = 0.0;
+    pending.numberOfSubSteps = 1u;
+    pending.tableau = LorenzKernels::RungeKutta4;
+    numberOfNodesOutput = NULL_PTR(uint32 *);
+    lyapunovEnabled = false;
+    lyapunovTimeConstant = 0.0;
+    tangent[0] = NULL_PTR(float64 *);
+    tangent[1] = NULL_PTR(float64 *);
+    lyapunovAccumulator = NULL_PTR(float64 *);
+    lyapunovStartTime = NULL_PTR(float64 *);
+    lyapunovOutput = NULL_PTR(float64 *);
+    cycleStartTime = 0.0;
+    stageKind = LorenzKernels::FirstStage;
+    coupled = false;
+    couplingStrength = 0.0;
+    reorderNodes = true;
+    numberOfEdges = 0u;
+    edgeRows = NULL_PTR(uint32 *);
+    edgeColumns = NULL_PTR(uint32 *);
+    edgeWeights = NULL_PTR(float64 *);
+    numberOfWorkers = 0u;
+    workerCPUs = 0u;
+    sweepCPUs = 0u;
+    realTimeCPUs = 0u;
+    sweepProgressOutput = NULL_PTR(uint32 *);
+    sweepStateOutput = NULL_PTR(uint32 *);
+    time = 0.0;
+    timeOutput = NULL_PTR(float64 *);
+    previousState = NULL_PTR(float64 *);
+    eventsEnabled = false;
+    numberOfEventFunctions = 0u;
+    eventFunctions = NULL_PTR(float64 *);
+    eventFunctionTypes = NULL_PTR(int32 *);
+    eventCapacity = 0u;
+    eventCountOutput = NULL_PTR(uint32 *);
+    eventTimesOutput = NULL_PTR(float64 *);
+    eventNodesOutput = NULL_PTR(uint32 *);
+    eventTypesOutput = NULL_PTR(int32 *);
+    partitionEventCount = NULL_PTR(uint32 *);
+    partitionEventTimes = NULL_PTR(float64 *);
+    partitionEventNodes = NULL_PTR(uint32 *);
+    partitionEventTypes = NULL_PTR(int32 *);
+    arenaHugePages = true;
+    arenaLock = true;
+    partitionZeroPlaced = 0;
+    initialConditionsSource = static_cast<uint32>(DefaultInitialConditions);
+    initialConditionsSeed = 1u;
+    uint32 c;
+    for (c = 0u; c < 3u; c++) {
+        generatorOrigin[c] = 0.0;
+        generatorExtent[c] = 0.0;
+    }
+    nodeParametersEnabled = false;
+    nodeParameters = NULL_PTR(float64 *);
+    nodeParameters32 = NULL_PTR(float32 *);
+    logVerbosity = LorenzLog::DefaultVerbosity;
+    logRate = LorenzLog::DefaultRate;
+    logBurst = LorenzLog::DefaultBurst;
+    logCapacity = LorenzLog::DefaultCapacity;
+    logCPUs = 0u;
+    numberOfLoggedSignals = 0u;
+    signalNames = NULL_PTR(StreamString *);
+    signalTypes = NULL_PTR(TypeDescriptor *);
+    signalElements = NULL_PTR(uint32 *);
+    signalByteSizes = NULL_PTR(uint32 *);
 }
 
 LorenzAttractor::~LorenzAttractor() {
+    diagnostics.Stop();
+    workers.Stop();
+    delete[] edgeRows;
+    delete[] edgeColumns;
+    delete[] edgeWeights;
+    delete[] eventFunctions;
+    delete[] eventFunctionTypes;
+    delete[] signalNames;
+    delete[] signalTypes;
+    delete[] signalElements;
+    delete[] signalByteSizes;
+}
 
+bool LorenzAttractor::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        modelEnabled = data.Read("TimeStep", timeStep);
+    }
+    if ((ok) && (modelEnabled)) {
+        ok = (timeStep > 0.0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "TimeStep shall be > 0");
+        }
+    }
+    if ((ok) && (modelEnabled)) {
+        if (!data.Read("Sigma", parameters.sigma)) {
+            REPORT_ERROR(ErrorManagement::Information, "Sigma not set. Using default %f", parameters.sigma);
+        }
+        if (!data.Read("Rho", parameters.rho)) {
+            REPORT_ERROR(ErrorManagement::Information, "Rho not set. Using default %f", parameters.rho);
+        }
+        if (!data.Read("Beta", parameters.beta)) {
+            REPORT_ERROR(ErrorManagement::Information, "Beta not set. Using default %f", parameters.beta);
+        }
+        if (!data.Read("NumberOfSubSteps", numberOfSubSteps)) {
+            numberOfSubSteps = 1u;
+        }
+        ok = (numberOfSubSteps > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfSubSteps shall be > 0");
+        }
+        if (!data.Read("NumberOfNodes", numberOfNodes)) {
+            numberOfNodes = 0u;
+        }
+        StreamString integrator;
+        if (data.Read("Integrator", integrator)) {
+            ok = LorenzKernels::GetTableau(integrator.Buffer(), tableau);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported Integrator %s", integrator.Buffer());
+            }
+        }
+        if (!data.Read("NumberOfWorkers", numberOfWorkers)) {
+            numberOfWorkers = 0u;
+        }
+        if (!data.Read("WorkerCPUs", workerCPUs)) {
+            workerCPUs = 0u;
+        }
+        if (!data.Read("SweepCPUs", sweepCPUs)) {
+            sweepCPUs = 0u;
+        }
+        if (!data.Read("RealTimeCPUs", realTimeCPUs)) {
+            realTimeCPUs = 0u;
+        }
+        if (sweepCPUs != 0u) {
+            // Unpinned workers or an unknown real-time core could share a CPU with the sweep threads
+            ok = ((realTimeCPUs != 0u) && ((numberOfWorkers == 0u) || (workerCPUs != 0u)));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "SweepCPUs requires RealTimeCPUs and, with NumberOfWorkers > 0, WorkerCPUs");
+            }
+            if (ok) {
+                ok = ((sweepCPUs & (workerCPUs | realTimeCPUs)) == 0u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "SweepCPUs shall not overlap WorkerCPUs or RealTimeCPUs");
+                }
+            }
+        }
+        StreamString precision;
+        if ((ok) && (data.Read("Precision", precision))) {
+            singlePrecision = ((precision == "Float32") || (precision == "Float32Compensated"));
+            compensated = (precision == "Float32Compensated");
+            ok = ((singlePrecision) || (precision == "Float64"));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported Precision %s", precision.Buffer());
+            }
+        }
+    }
+    if ((ok) && (modelEnabled)) {
+        coupled = data.MoveRelative("Coupling");
+    }
+    if ((ok) && (coupled)) {
+        ok = data.Read("Strength", couplingStrength);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Coupling.Strength shall be set");
+        }
+        if (ok) {
+            numberOfEdges = data.GetType("Rows").GetNumberOfElements(0u);
+            ok = ((numberOfEdges > 0u) && (data.GetType("Columns").GetNumberOfElements(0u) == numberOfEdges));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Coupling.Rows and Coupling.Columns shall have the same (non-zero) number of elements");
+            }
+        }
+        if (ok) {
+            edgeRows = new uint32[numberOfEdges];
+            edgeColumns = new uint32[numberOfEdges];
+            Vector<uint32> rowsVector(edgeRows, numberOfEdges);
+            Vector<uint32> columnsVector(edgeColumns, numberOfEdges);
+            ok = (data.Read("Rows", rowsVector) && data.Read("Columns", columnsVector));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Failed to read Coupling.Rows or Coupling.Columns");
+            }
+        }
+        if ((ok) && (!data.GetType("Weights").IsVoid())) {
+            ok = (data.GetType("Weights").GetNumberOfElements(0u) == numberOfEdges);
+            if (ok) {
+                edgeWeights = new float64[numberOfEdges];
+                Vector<float64> weightsVector(edgeWeights, numberOfEdges);
+                ok = data.Read("Weights", weightsVector);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Coupling.Weights shall have one element per edge");
+            }
+        }
+        if (ok) {
+            StreamString reordering;
+            if (data.Read("Reordering", reordering)) {
+                reorderNodes = (reordering == "RCM");
+                ok = ((reorderNodes) || (reordering == "None"));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "Coupling.Reordering shall be RCM or None");
+                }
+            }
+        }
+        if (!data.MoveToAncestor(1u)) {
+            ok = false;
+        }
+    }
+    if ((ok) && (modelEnabled)) {
+        lyapunovEnabled = data.MoveRelative("Lyapunov");
+    }
+    if ((ok) && (lyapunovEnabled)) {
+        if (!data.Read("TimeConstant", lyapunovTimeConstant)) {
+            lyapunovTimeConstant = 0.0;
+        }
+        ok = (lyapunovTimeConstant >= 0.0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Lyapunov.TimeConstant shall be >= 0");
+        }
+        if (!data.MoveToAncestor(1u)) {
+            ok = false;
+        }
+    }
+    if ((ok) && (modelEnabled)) {
+        eventsEnabled = data.MoveRelative("Events");
+    }
+    if ((ok) && (eventsEnabled)) {
+        uint32 lobeSwitches = 1u;
+        if (!data.Read("LobeSwitches", lobeSwitches)) {
+            lobeSwitches = 1u;
+        }
+        uint32 numberOfPlanes = 0u;
+        bool hasPlanes = data.MoveRelative("Planes");
+        if (hasPlanes) {
+            numberOfPlanes = data.GetNumberOfChildren();
+        }
+        numberOfEventFunctions = numberOfPlanes + ((lobeSwitches != 0u) ? (1u) : (0u));
+        ok = (numberOfEventFunctions > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Events requires LobeSwitches = 1 or at least one of the Planes");
+        }
+        if (ok) {
+            eventFunctions = new float64[4u * numberOfEventFunctions];
+            eventFunctionTypes = new int32[numberOfEventFunctions];
+        }
+        uint32 f = 0u;
+        if ((ok) && (lobeSwitches != 0u)) {
+            // The lobe switch is the crossing of the plane x = 0
+            eventFunctions[0u] = 1.0;
+            eventFunctions[1u] = 0.0;
+            eventFunctions[2u] = 0.0;
+            eventFunctions[3u] = 0.0;
+            eventFunctionTypes[0u] = 1;
+            f++;
+        }
+        uint32 p;
+        for (p = 0u; (p < numberOfPlanes) && (ok); p++) {
+            ok = data.MoveToChild(p);
+            if (ok) {
+                Vector<float64> normal(&eventFunctions[4u * f], 3u);
+                ok = (data.Read("Normal", normal) && data.Read("Offset", eventFunctions[(4u * f) + 3u]));
+                eventFunctionTypes[f] = static_cast<int32>(p + 2u);
+                f++;
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Each of the Events.Planes shall define a Normal (3 elements) and an Offset");
+            }
+            if (!data.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+        if (hasPlanes) {
+            if (!data.MoveToAncestor(1u)) {
+                ok = false;
+            }
+        }
+        if (!data.MoveToAncestor(1u)) {
+            ok = false;
+        }
+    }
+    if ((ok) && (modelEnabled) && (data.MoveRelative("InitialConditions"))) {
+        StreamString source;
+        ok = data.Read("Source", source);
+        if ((ok) && (source == "File")) {
+            initialConditionsSource = static_cast<uint32>(FileInitialConditions);
+            ok = data.Read("File", initialConditionsFileName);
+        }
+        else if ((ok) && (source == "UniformBox")) {
+            initialConditionsSource = static_cast<uint32>(UniformBoxInitialConditions);
+            float64 maximum[3];
+            Vector<float64> minimumVector(&generatorOrigin[0], 3u);
+            Vector<float64> maximumVector(&maximum[0], 3u);
+            ok = (data.Read("Minimum", minimumVector) && data.Read("Maximum", maximumVector));
+            uint32 c;
+            for (c = 0u; (c < 3u) && (ok); c++) {
+                generatorExtent[c] = maximum[c] - generatorOrigin[c];
+                ok = (generatorExtent[c] >= 0.0);
+            }
+        }
+        else if ((ok) && (source == "GaussianBall")) {
+            initialConditionsSource = static_cast<uint32>(GaussianBallInitialConditions);
+            float64 standardDeviation = 0.0;
+            Vector<float64> centerVector(&generatorOrigin[0], 3u);
+            ok = (data.Read("Center", centerVector) && data.Read("StandardDeviation", standardDeviation));
+            if (ok) {
+                ok = (standardDeviation >= 0.0);
+            }
+            uint32 c;
+            for (c = 0u; c < 3u; c++) {
+                generatorExtent[c] = standardDeviation;
+            }
+        }
+        else {
+            ok = false;
+        }
+        if (!data.Read("Seed", initialConditionsSeed)) {
+            initialConditionsSeed = 1u;
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "InitialConditions shall set Source = File (and File), UniformBox (and Minimum <= Maximum) "
+                         "or GaussianBall (and Center and StandardDeviation >= 0)");
+        }
+        if (!data.MoveToAncestor(1u)) {
+            ok = false;
+        }
+    }
+    if ((ok) && (modelEnabled) && (data.MoveRelative("Memory"))) {
+        uint32 flag = 1u;
+        if (!data.Read("HugePages", flag)) {
+            flag = 1u;
+        }
+        arenaHugePages = (flag != 0u);
+        if (!data.Read("Lock", flag)) {
+            flag = 1u;
+        }
+        arenaLock = (flag != 0u);
+        if (!data.MoveToAncestor(1u)) {
+            ok = false;
+        }
+    }
+    if ((ok) && (data.MoveRelative("Diagnostics"))) {
+        if (!data.Read("Verbosity", logVerbosity)) {
+            logVerbosity = LorenzLog::DefaultVerbosity;
+        }
+        if (!data.Read("Rate", logRate)) {
+            logRate = LorenzLog::DefaultRate;
+        }
+        if (!data.Read("Burst", logBurst)) {
+            logBurst = LorenzLog::DefaultBurst;
+        }
+        if (!data.Read("Capacity", logCapacity)) {
+            logCapacity = LorenzLog::DefaultCapacity;
+        }
+        if (!data.Read("CPUs", logCPUs)) {
+            logCPUs = 0u;
+        }
+        ok = ((logRate > 0u) && (logBurst > 0u) && (logCapacity > 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Diagnostics.Rate, Diagnostics.Burst and Diagnostics.Capacity shall be > 0");
+        }
+        if (!data.MoveToAncestor(1u)) {
+            ok = false;
+        }
+    }
+    if ((ok) && (singlePrecision)) {
+        ok = ((!lyapunovEnabled) && (!eventsEnabled));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Lyapunov and Events require Precision = Float64");
+        }
+    }
+    if ((ok) && (lyapunovEnabled)) {
+        // The exponents are per node: for a network the tangent vector would be global and renormalised as a whole
+        ok = (!coupled);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Lyapunov is not supported with Coupling");
+        }
+    }
+    return ok;
 }
 
 bool LorenzAttractor::Setup() {
@@ -65,6 +509,23 @@ bool LorenzAttractor::Setup() {
         REPORT_ERROR(ErrorManagement::InitialisationError, "GetNumberOfInputSignals() != 0u");
     }
 
+    if (ret) {
+        // The log thread only reads these copies, never the signal database: stop it before they are refreshed by a new Setup()
+        diagnostics.Stop();
+        if (numberOfLoggedSignals != GetNumberOfOutputSignals()) {
+            delete[] signalNames;
+            delete[] signalTypes;
+            delete[] signalElements;
+            delete[] signalByteSizes;
+            numberOfLoggedSignals = GetNumberOfOutputSignals();
+            signalNames = new StreamString[numberOfLoggedSignals];
+            signalTypes = new TypeDescriptor[numberOfLoggedSignals];
+            signalElements = new uint32[numberOfLoggedSignals];
+            signalByteSizes = new uint32[numberOfLoggedSignals];
+        }
+        ret = diagnostics.Start(logVerbosity, logRate, logBurst, logCapacity, logCPUs, &LogFormatter, this);
+    }
+
     uint32 signalIndex;
 
     for (signalIndex = 0u; (signalIndex < GetNumberOfOutputSignals()) && (ret); signalIndex++) {
@@ -86,10 +547,12 @@ bool LorenzAttractor::Setup() {
             ret = (signalType != InvalidType);
         }
 
-        StreamString signalTypeName = TypeDescriptor::GetTypeNameFromTypeDescriptor(signalType);
-
         if (ret) {
-            REPORT_ERROR(ErrorManagement::Information, "Signal '%!' has type '%!'", signalName.Buffer(), signalTypeName.Buffer());
+            signalNames[signalIndex] = signalName;
+            signalTypes[signalIndex] = signalType;
+            signalByteSizes[signalIndex] = signalByteSize;
+            signalElements[signalIndex] = 1u;
+            diagnostics.Add(LorenzLog::InformationLevel, LogSignalType, signalIndex, 0u, NULL_PTR(const void *), 0u);
         }
 
         if (ret) {
@@ -119,12 +582,14 @@ bool LorenzAttractor::Setup() {
                 for (dimensionIndex = 0u; ((dimensionIndex < signalNumberOfDimensions) && (ret)); dimensionIndex++) {
                     uint32 dimensionNumberOfElements = signalDefType.GetNumberOfElements(static_cast<uint32>(dimensionIndex));
                     signalDefValue.SetNumberOfElements(static_cast<uint32>(dimensionIndex), dimensionNumberOfElements);
+                    signalElements[signalIndex] *= dimensionNumberOfElements;
                 }
             }
             else {
                 ret = GetSignalNumberOfElements(OutputSignals, signalIndex, signalNumberOfElements);
                 if (signalNumberOfElements > 1u) {
                     signalNumberOfDimensions = 1u;
+                    signalElements[signalIndex] = signalNumberOfElements;
                 }
                 if (ret) {
                     if (signalNumberOfDimensions > 0u) {
@@ -138,18 +603,33 @@ bool LorenzAttractor::Setup() {
         }
 
         if (ret) {
-            ret = configuredDatabase.Read("Default", signalDefValue);
+            // The signals which are computed by the model do not need a Default
+            // Neither do X, Y and Z if the initial conditions are loaded in bulk
+            const bool bulkState = ((initialConditionsSource != static_cast<uint32>(DefaultInitialConditions))
+                    && ((signalName == "X") || (signalName == "Y") || (signalName == "Z")));
+            if ((modelEnabled) && (signalDefType.IsVoid()) && ((IsModelOutput(signalName)) || (bulkState))) {
+                ret = MemoryOperationsHelper::Set(GetOutputSignalMemory(signalIndex), '\0', signalByteSize);
+            }
+            else {
+                ret = configuredDatabase.Read("Default", signalDefValue);
+            }
         }
 
-        if (ret) {
-            REPORT_ERROR(ErrorManagement::Information, "Signal '%!' has value '%!'", signalName.Buffer(), signalDefValue);
-        }
-        else {
+        if (!ret) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "LorenzAttractor::Setup - GetSignalDefaultValue '%s'", signalName.Buffer());
         }
 
     }
 
+    if ((ret) && (modelEnabled)) {
+        ret = SetupModel();
+    }
+
+    // Once the initial conditions are loaded, so that X, Y and Z are logged with their initial value
+    for (signalIndex = 0u; (signalIndex < GetNumberOfOutputSignals()) && (ret); signalIndex++) {
+        LogSignal(LorenzLog::InformationLevel, LogSignalValue, signalIndex);
+    }
+
     // Install message filter
     ReferenceT<RegisteredMethodsMessageFilter> registeredMethodsMessageFilter("RegisteredMethodsMessageFilter");
 
@@ -165,7 +645,812 @@ bool LorenzAttractor::Setup() {
     return ret;
 }
 
+bool LorenzAttractor::SetupModel() {
+    const char8 * const stateNames[3] = { "X", "Y", "Z" };
+    bool ok = true;
+    uint32 c;
+    for (c = 0u; (c < 3u) && (ok); c++) {
+        uint32 signalIndex = 0u;
+        uint32 signalNumberOfElements = 0u;
+        ok = GetSignalIndex(OutputSignals, signalIndex, stateNames[c]);
+        if (ok) {
+            ok = (GetSignalType(OutputSignals, signalIndex) == Float64Bit);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(OutputSignals, signalIndex, signalNumberOfElements);
+        }
+        if (ok) {
+            if (c == 0u) {
+                maximumNumberOfNodes = signalNumberOfElements;
+            }
+            ok = ((signalNumberOfElements > 0u) && (signalNumberOfElements == maximumNumberOfNodes));
+        }
+        if (ok) {
+            outputState[c] = static_cast<float64 *>(GetOutputSignalMemory(signalIndex));
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The model requires float64 output signals X, Y and Z with the same number of elements");
+        }
+    }
+    if (ok) {
+        if (numberOfNodes == 0u) {
+            numberOfNodes = maximumNumberOfNodes;
+        }
+        ok = (numberOfNodes <= maximumNumberOfNodes);
+        if ((ok) && (coupled)) {
+            ok = (numberOfNodes == maximumNumberOfNodes);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfNodes shall be <= %u (and equal to it if coupled)", maximumNumberOfNodes);
+        }
+    }
+    if ((ok) && (coupled)) {
+        ok = network.Build(maximumNumberOfNodes, numberOfEdges, edgeRows, edgeColumns, edgeWeights, reorderNodes);
+        if (ok) {
+            REPORT_ERROR(ErrorManagement::Information, "Coupling matrix with %u nodes, %u edges and bandwidth %u", maximumNumberOfNodes, numberOfEdges,
+                         network.GetBandwidth());
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The Coupling node indices shall be < %u", maximumNumberOfNodes);
+        }
+    }
+    delete[] edgeRows;
+    delete[] edgeColumns;
+    delete[] edgeWeights;
+    edgeRows = NULL_PTR(uint32 *);
+    edgeColumns = NULL_PTR(uint32 *);
+    edgeWeights = NULL_PTR(float64 *);
+    if (ok) {
+        ok = workers.Start(numberOfWorkers, numberOfNodes, workerCPUs);
+    }
+    uint32 signalIndex = 0u;
+    if (ok) {
+        time = 0.0;
+        if (GetSignalIndex(OutputSignals, signalIndex, "Time")) {
+            ok = (GetSignalType(OutputSignals, signalIndex) == Float64Bit);
+            if (ok) {
+                timeOutput = static_cast<float64 *>(GetOutputSignalMemory(signalIndex));
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The Time signal shall be float64");
+            }
+        }
+    }
+    if (ok) {
+        if (GetSignalIndex(OutputSignals, signalIndex, "NumberOfNodes")) {
+            ok = (GetSignalType(OutputSignals, signalIndex) == UnsignedInteger32Bit);
+            if (ok) {
+                numberOfNodesOutput = static_cast<uint32 *>(GetOutputSignalMemory(signalIndex));
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The NumberOfNodes signal shall be uint32");
+            }
+        }
+    }
+    if (ok) {
+        if (GetSignalIndex(OutputSignals, signalIndex, "SweepProgress")) {
+            ok = (GetSignalType(OutputSignals, signalIndex) == UnsignedInteger32Bit);
+            if (ok) {
+                sweepProgressOutput = static_cast<uint32 *>(GetOutputSignalMemory(signalIndex));
+            }
+        }
+        if ((ok) && (GetSignalIndex(OutputSignals, signalIndex, "SweepState"))) {
+            ok = (GetSignalType(OutputSignals, signalIndex) == UnsignedInteger32Bit);
+            if (ok) {
+                sweepStateOutput = static_cast<uint32 *>(GetOutputSignalMemory(signalIndex));
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The SweepProgress and SweepState signals shall be uint32");
+        }
+    }
+    if (ok) {
+        ok = reconfigurationSem.Create();
+    }
+    if ((ok) && (lyapunovEnabled)) {
+        uint32 signalNumberOfElements = 0u;
+        ok = GetSignalIndex(OutputSignals, signalIndex, "Lyapunov");
+        if (ok) {
+            ok = ((GetSignalType(OutputSignals, signalIndex) == Float64Bit)
+                    && (GetSignalNumberOfElements(OutputSignals, signalIndex, signalNumberOfElements)));
+        }
+        if (ok) {
+            ok = (signalNumberOfElements == maximumNumberOfNodes);
+        }
+        if (ok) {
+            lyapunovOutput = static_cast<float64 *>(GetOutputSignalMemory(signalIndex));
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Lyapunov requires a float64 Lyapunov signal with the same number of elements as X");
+        }
+    }
+    if ((ok) && (eventsEnabled)) {
+        ok = GetSignalIndex(OutputSignals, signalIndex, "EventCount");
+        if (ok) {
+            ok = (GetSignalType(OutputSignals, signalIndex) == UnsignedInteger32Bit);
+        }
+        if (ok) {
+            eventCountOutput = static_cast<uint32 *>(GetOutputSignalMemory(signalIndex));
+            ok = GetSignalIndex(OutputSignals, signalIndex, "EventTimes");
+        }
+        if (ok) {
+            ok = (GetSignalType(OutputSignals, signalIndex) == Float64Bit);
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(OutputSignals, signalIndex, eventCapacity);
+        }
+        if (ok) {
+            eventTimesOutput = static_cast<float64 *>(GetOutputSignalMemory(signalIndex));
+            ok = GetSignalIndex(OutputSignals, signalIndex, "EventNodes");
+        }
+        uint32 signalNumberOfElements = 0u;
+        if (ok) {
+            ok = ((GetSignalType(OutputSignals, signalIndex) == UnsignedInteger32Bit)
+                    && (GetSignalNumberOfElements(OutputSignals, signalIndex, signalNumberOfElements)));
+        }
+        if (ok) {
+            ok = (signalNumberOfElements == eventCapacity);
+        }
+        if (ok) {
+            eventNodesOutput = static_cast<uint32 *>(GetOutputSignalMemory(signalIndex));
+            ok = GetSignalIndex(OutputSignals, signalIndex, "EventTypes");
+        }
+        if (ok) {
+            ok = ((GetSignalType(OutputSignals, signalIndex) == SignedInteger32Bit)
+                    && (GetSignalNumberOfElements(OutputSignals, signalIndex, signalNumberOfElements)));
+        }
+        if (ok) {
+            ok = (signalNumberOfElements == eventCapacity);
+        }
+        if (ok) {
+            eventTypesOutput = static_cast<int32 *>(GetOutputSignalMemory(signalIndex));
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError,
+                         "Events require the signals EventCount (uint32), EventTimes (float64), EventNodes (uint32) and EventTypes (int32), the last three with the same number of elements");
+        }
+    }
+    if ((ok) && (initialConditionsSource == static_cast<uint32>(FileInitialConditions))) {
+        ok = OpenInitialConditions();
+    }
+    if (ok) {
+        ok = SetupArena();
+    }
+    if (ok) {
+        // The initial conditions are the Default values, in the configured node order. They are kept to (re)start nodes activated by Reconfigure.
+        if (initialConditionsSource != static_cast<uint32>(DefaultInitialConditions)) {
+            LoadInitialConditions();
+        }
+        const uint32 * const permutation = (coupled) ? (network.GetPermutation()) : (NULL_PTR(const uint32 *));
+        for (c = 0u; c < 3u; c++) {
+            uint32 i;
+            for (i = 0u; i < maximumNumberOfNodes; i++) {
+                initialState[(c * maximumNumberOfNodes) + i] = outputState[c][(permutation != NULL_PTR(const uint32 *)) ? (permutation[i]) : (i)];
+            }
+        }
+        InitialiseNodes(0u, maximumNumberOfNodes);
+        stageArguments.parameters = parameters;
+        stageArguments.elementParameters = nodeParameters;
+        if (coupled) {
+            stageArguments.coupling = network.GetView(couplingStrength);
+        }
+        else {
+            stageArguments.coupling.rowStart = NULL_PTR(const uint32 *);
+            stageArguments.coupling.columns = NULL_PTR(const uint32 *);
+            stageArguments.coupling.weights = NULL_PTR(const float64 *);
+            stageArguments.coupling.degree = NULL_PTR(const float64 *);
+            stageArguments.coupling.strength = 0.0;
+        }
+        stageArguments.compensation = NULL_PTR(float64 *);
+        stageArguments.stride = maximumNumberOfNodes;
+        stageArguments.timeStep = timeStep;
+        stageArguments32.parameters.sigma = static_cast<float32>(parameters.sigma);
+        stageArguments32.parameters.rho = static_cast<float32>(parameters.rho);
+        stageArguments32.parameters.beta = static_cast<float32>(parameters.beta);
+        stageArguments32.elementParameters = nodeParameters32;
+        stageArguments32.coupling = stageArguments.coupling;
+        stageArguments32.accumulator = accumulator32;
+        stageArguments32.compensation = compensation;
+        stageArguments32.stride = maximumNumberOfNodes;
+        stageArguments32.timeStep = static_cast<float32>(timeStep);
+        if (lyapunovEnabled) {
+            ResetLyapunov(0u, maximumNumberOfNodes);
+        }
+    }
+    initialConditionsFile.Close();
+    return ok;
+}
+
+bool LorenzAttractor::OpenInitialConditions() {
+    bool ok = initialConditionsFile.Open(initialConditionsFileName.Buffer());
+    if (ok) {
+        ok = (initialConditionsFile.GetNumberOfRecords() == maximumNumberOfNodes);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The InitialConditions file shall have %u records (one per node)", maximumNumberOfNodes);
+        }
+    }
+    const char8 * const fieldNames[6] = { "X", "Y", "Z", "Sigma", "Rho", "Beta" };
+    uint32 f;
+    for (f = 0u; (f < 6u) && (ok); f++) {
+        uint32 type = 0u;
+        const bool found = (initialConditionsFile.GetField(fieldNames[f], type) != NULL_PTR(const void *));
+        if (found) {
+            ok = ((type == static_cast<uint32>(LorenzArrayFile::Float64Field)) || (type == static_cast<uint32>(LorenzArrayFile::Float32Field)));
+            nodeParametersEnabled = ((nodeParametersEnabled) || (f >= 3u));
+        }
+        else {
+            ok = (f >= 3u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The InitialConditions file shall have the float64 or float32 fields X, Y and Z "
+                         "(and optionally Sigma, Rho and Beta)");
+        }
+    }
+    if ((ok) && (nodeParametersEnabled) && (coupled)) {
+        ok = false;
+        REPORT_ERROR(ErrorManagement::InitialisationError, "Per-node Sigma, Rho and Beta are not supported with Coupling");
+    }
+    return ok;
+}
+
+void LorenzAttractor::LoadInitialConditions() {
+    const uint32 n = maximumNumberOfNodes;
+    if (initialConditionsSource == static_cast<uint32>(FileInitialConditions)) {
+        const char8 * const fieldNames[6] = { "X", "Y", "Z", "Sigma", "Rho", "Beta" };
+        const float64 modelValues[3] = { parameters.sigma, parameters.rho, parameters.beta };
+        uint32 f;
+        for (f = 0u; f < 6u; f++) {
+            float64 *destination = NULL_PTR(float64 *);
+            if (f < 3u) {
+                destination = outputState[f];
+            }
+            else if (nodeParameters != NULL_PTR(float64 *)) {
+                destination = &nodeParameters[(f - 3u) * n];
+            }
+            else {
+                // No per-node parameters
+            }
+            if (destination != NULL_PTR(float64 *)) {
+                uint32 type = 0u;
+                const void * const field = initialConditionsFile.GetField(fieldNames[f], type);
+                uint32 i;
+                if (field == NULL_PTR(const void *)) {
+                    for (i = 0u; i < n; i++) {
+                        destination[i] = modelValues[f - 3u];
+                    }
+                }
+                else if (type == static_cast<uint32>(LorenzArrayFile::Float64Field)) {
+                    (void) MemoryOperationsHelper::Copy(destination, field, n * static_cast<uint32>(sizeof(float64)));
+                }
+                else {
+                    const float32 * const values = static_cast<const float32 *>(field);
+                    for (i = 0u; i < n; i++) {
+                        destination[i] = static_cast<float64>(values[i]);
+                    }
+                }
+            }
+        }
+        if (nodeParameters32 != NULL_PTR(float32 *)) {
+            uint32 k;
+            for (k = 0u; k < (3u * n); k++) {
+                nodeParameters32[k] = static_cast<float32>(nodeParameters[k]);
+            }
+        }
+    }
+    else {
+        LorenzRandom random(static_cast<uint64>(initialConditionsSeed));
+        const bool uniform = (initialConditionsSource == static_cast<uint32>(UniformBoxInitialConditions));
+        uint32 i;
+        for (i = 0u; i < n; i++) {
+            uint32 c;
+            for (c = 0u; c < 3u; c++) {
+                const float64 sample = (uniform) ? (random.Uniform()) : (random.Gaussian());
+                outputState[c][i] = generatorOrigin[c] + (generatorExtent[c] * sample);
+            }
+        }
+    }
+}
+
+bool LorenzAttractor::SetupArena() {
+    const uint32 n = maximumNumberOfNodes;
+    const uint32 stateSize = static_cast<uint32>((singlePrecision) ? (sizeof(float32)) : (sizeof(float64)));
+    const uint32 numberOfPartitions = workers.GetNumberOfPartitions();
+    uint32 stateBlocks[3];
+    uint32 accumulatorBlock = 0u;
+    uint32 compensationBlock = 0u;
+    uint32 initialStateBlock = 0u;
+    uint32 tangentBlocks[2] = { 0u, 0u };
+    uint32 lyapunovAccumulatorBlock = 0u;
+    uint32 lyapunovStartTimeBlock = 0u;
+    uint32 eventBlocks[4] = { 0u, 0u, 0u, 0u };
+    uint32 nodeParametersBlock = 0u;
+    uint32 nodeParameters32Block = 0u;
+    bool ok = true;
+    uint32 b;
+    for (b = 0u; (b < 3u) && (ok); b++) {
+        ok = arena.Reserve(3u, n, stateSize, false, stateBlocks[b]);
+    }
+    if (ok) {
+        ok = arena.Reserve(3u, n, stateSize, false, accumulatorBlock);
+    }
+    if ((ok) && (compensated)) {
+        ok = arena.Reserve(3u, n, static_cast<uint32>(sizeof(float32)), false, compensationBlock);
+    }
+    if (ok) {
+        ok = arena.Reserve(3u, n, static_cast<uint32>(sizeof(float64)), false, initialStateBlock);
+    }
+    if ((ok) && (lyapunovEnabled)) {
+        ok = (arena.Reserve(3u, n, static_cast<uint32>(sizeof(float64)), false, tangentBlocks[0])
+                && arena.Reserve(3u, n, static_cast<uint32>(sizeof(float64)), false, tangentBlocks[1])
+                && arena.Reserve(1u, n, static_cast<uint32>(sizeof(float64)), false, lyapunovAccumulatorBlock)
+                && arena.Reserve(1u, n, static_cast<uint32>(sizeof(float64)), false, lyapunovStartTimeBlock));
+    }
+    if ((ok) && (nodeParametersEnabled)) {
+        ok = arena.Reserve(3u, n, static_cast<uint32>(sizeof(float64)), false, nodeParametersBlock);
+        if ((ok) && (singlePrecision)) {
+            ok = arena.Reserve(3u, n, static_cast<uint32>(sizeof(float32)), false, nodeParameters32Block);
+        }
+    }
+    if ((ok) && (eventsEnabled)) {
+        // One buffer per partition
+        ok = (arena.Reserve(numberOfPartitions, 1u, static_cast<uint32>(sizeof(uint32)), true, eventBlocks[0])
+                && arena.Reserve(numberOfPartitions, eventCapacity, static_cast<uint32>(sizeof(float64)), true, eventBlocks[1])
+                && arena.Reserve(numberOfPartitions, eventCapacity, static_cast<uint32>(sizeof(uint32)), true, eventBlocks[2])
+                && arena.Reserve(numberOfPartitions, eventCapacity, static_cast<uint32>(sizeof(int32)), true, eventBlocks[3]));
+    }
+    if (ok) {
+        ok = arena.Allocate(arenaHugePages);
+    }
+    if (ok) {
+        if (singlePrecision) {
+            for (b = 0u; b < 3u; b++) {
+                stateBuffers32[b] = static_cast<float32 *>(arena.GetBlock(stateBlocks[b]));
+            }
+            state32 = stateBuffers32[0];
+            stageBuffer32[0] = stateBuffers32[1];
+            stageBuffer32[1] = stateBuffers32[2];
+            accumulator32 = static_cast<float32 *>(arena.GetBlock(accumulatorBlock));
+            if (compensated) {
+                compensation = static_cast<float32 *>(arena.GetBlock(compensationBlock));
+            }
+        }
+        else {
+            for (b = 0u; b < 3u; b++) {
+                stateBuffers[b] = static_cast<float64 *>(arena.GetBlock(stateBlocks[b]));
+            }
+            state = stateBuffers[0];
+            stageBuffer[0] = stateBuffers[1];
+            stageBuffer[1] = stateBuffers[2];
+            accumulator = static_cast<float64 *>(arena.GetBlock(accumulatorBlock));
+        }
+        initialState = static_cast<float64 *>(arena.GetBlock(initialStateBlock));
+        if (lyapunovEnabled) {
+            tangent[0] = static_cast<float64 *>(arena.GetBlock(tangentBlocks[0]));
+            tangent[1] = static_cast<float64 *>(arena.GetBlock(tangentBlocks[1]));
+            lyapunovAccumulator = static_cast<float64 *>(arena.GetBlock(lyapunovAccumulatorBlock));
+            lyapunovStartTime = static_cast<float64 *>(arena.GetBlock(lyapunovStartTimeBlock));
+        }
+        if (nodeParametersEnabled) {
+            nodeParameters = static_cast<float64 *>(arena.GetBlock(nodeParametersBlock));
+            if (singlePrecision) {
+                nodeParameters32 = static_cast<float32 *>(arena.GetBlock(nodeParameters32Block));
+            }
+        }
+        if (eventsEnabled) {
+            partitionEventCount = static_cast<uint32 *>(arena.GetBlock(eventBlocks[0]));
+            partitionEventTimes = static_cast<float64 *>(arena.GetBlock(eventBlocks[1]));
+            partitionEventNodes = static_cast<uint32 *>(arena.GetBlock(eventBlocks[2]));
+            partitionEventTypes = static_cast<int32 *>(arena.GetBlock(eventBlocks[3]));
+        }
+        // First touch by the thread which integrates each partition, i.e. on its NUMA node. Partition 0 is integrated by the
+        // real-time thread, which does not exist yet: its pages are touched by a transient thread pinned on the RealTimeCPUs
+        // (by the thread calling Setup() if they are not declared). Prefault() then faults in, on the node of the thread calling
+        // Setup(), the pages of no partition (the nodes beyond NumberOfNodes), so that Execute() never takes a page fault.
+        if (realTimeCPUs != 0u) {
+            ok = PlacePartitionZero();
+        }
+        workers.Run(&TouchJob, this);
+        arena.Prefault(arenaLock);
+        REPORT_ERROR(ErrorManagement::Information, "Arena of %u bytes (explicit huge pages: %u, locked: %u)", arena.GetSize(),
+                     arena.IsHugePageBacked() ? 1u : 0u, arena.IsLocked() ? 1u : 0u);
+    }
+    return ok;
+}
+
+void LorenzAttractor::TouchJob(void * const context, const uint32 partition, const uint32 begin, const uint32 end) {
+    LorenzAttractor *gam = static_cast<LorenzAttractor *>(context);
+    if ((partition != 0u) || (gam->realTimeCPUs == 0u)) {
+        gam->arena.Touch(partition, begin, end);
+    }
+}
+
+bool LorenzAttractor::PlacePartitionZero() {
+    partitionZeroPlaced = 0;
+    ThreadIdentifier tid = Threads::BeginThread(&PlacementThread, this, THREADS_DEFAULT_STACKSIZE, "LorenzPlacement", ExceptionHandler::NotHandled,
+                                                ProcessorType(realTimeCPUs));
+    bool ok = (tid != InvalidThreadIdentifier);
+    if (ok) {
+        while (partitionZeroPlaced == 0) {
+            Sleep::MSec(1);
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to launch the thread placing the memory of partition 0 on the RealTimeCPUs");
+    }
+    return ok;
+}
+
+void LorenzAttractor::PlacementThread(const void * const arguments) {
+    LorenzAttractor *gam = static_cast<LorenzAttractor *>(const_cast<void *>(arguments));
+    uint32 begin;
+    uint32 end;
+    gam->workers.GetPartition(0u, begin, end);
+    gam->arena.Touch(0u, begin, end);
+    Atomic::Increment(&gam->partitionZeroPlaced);
+}
+
+void LorenzAttractor::StageJob(void * const context, const uint32, const uint32 begin, const uint32 end) {
+    LorenzAttractor *gam = static_cast<LorenzAttractor *>(context);
+    LorenzKernels::Stage(gam->stageArguments, gam->stageKind, begin, end);
+}
+
+void LorenzAttractor::SinglePrecisionStageJob(void * const context, const uint32, const uint32 begin, const uint32 end) {
+    LorenzAttractor *gam = static_cast<LorenzAttractor *>(context);
+    LorenzKernels::Stage(gam->stageArguments32, gam->stageKind, begin, end);
+}
+
+void LorenzAttractor::InitialiseNodes(const uint32 begin, const uint32 end) {
+    uint32 c;
+    for (c = 0u; c < 3u; c++) {
+        uint32 i;
+        for (i = begin; i < end; i++) {
+            const uint32 k = (c * maximumNumberOfNodes) + i;
+            uint32 b;
+            for (b = 0u; b < 3u; b++) {
+                if (singlePrecision) {
+                    stateBuffers32[b][k] = static_cast<float32>(initialState[k]);
+                }
+                else {
+                    stateBuffers[b][k] = initialState[k];
+                }
+            }
+            if (compensation != NULL_PTR(float32 *)) {
+                compensation[k] = 0.0F;
+            }
+        }
+    }
+}
+
+void LorenzAttractor::PublishJob(void * const context, const uint32, const uint32 begin, const uint32 end) {
+    LorenzAttractor *gam = static_cast<LorenzAttractor *>(context);
+    const uint32 n = gam->maximumNumberOfNodes;
+    const uint32 * const permutation = (gam->coupled) ? (gam->network.GetPermutation()) : (NULL_PTR(const uint32 *));
+    uint32 c;
+    for (c = 0u; c < 3u; c++) {
+        if (gam->singlePrecision) {
+            CopyState(&gam->state32[c * n], gam->outputState[c], permutation, begin, end);
+        }
+        else {
+            CopyState(&gam->state[c * n], gam->outputState[c], permutation, begin, end);
+        }
+    }
+}
+
+void LorenzAttractor::TangentJob(void * const context, const uint32, const uint32 begin, const uint32 end) {
+    LorenzAttractor *gam = static_cast<LorenzAttractor *>(context);
+    LorenzKernels::Tangent(gam->stageArguments.parameters, gam->stageArguments.elementParameters, gam->previousState, gam->state,
+                           gam->tangent[0], gam->tangent[1], gam->maximumNumberOfNodes, gam->timeStep, begin, end);
+}
+
+void LorenzAttractor::LyapunovJob(void * const context, const uint32, const uint32 begin, const uint32 end) {
+    LorenzAttractor *gam = static_cast<LorenzAttractor *>(context);
+    const uint32 n = gam->maximumNumberOfNodes;
+    float64 * const vx = gam->tangent[0];
+    float64 * const vy = &vx[n];
+    float64 * const vz = &vx[2u * n];
+    const float64 cycleTime = gam->time - gam->cycleStartTime;
+    const bool average = (gam->lyapunovTimeConstant <= 0.0);
+    const float64 alpha = (average) ? (0.0) : (cycleTime / gam->lyapunovTimeConstant);
+    const uint32 * const permutation = (gam->coupled) ? (gam->network.GetPermutation()) : (NULL_PTR(const uint32 *));
+    uint32 i;
+    for (i = begin; i < end; i++) {
+        const float64 norm = sqrt(((vx[i] * vx[i]) + (vy[i] * vy[i])) + (vz[i] * vz[i]));
+        float64 estimate = 0.0;
+        if ((norm > 0.0) && (cycleTime > 0.0)) {
+            const float64 growth = log(norm);
+            vx[i] /= norm;
+            vy[i] /= norm;
+            vz[i] /= norm;
+            if (gam->lyapunovStartTime[i] < 0.0) {
+                // Node (re)activated in this cycle
+                gam->lyapunovStartTime[i] = gam->cycleStartTime;
+            }
+            if (average) {
+                gam->lyapunovAccumulator[i] += growth;
+                estimate = gam->lyapunovAccumulator[i] / (gam->time - gam->lyapunovStartTime[i]);
+            }
+            else {
+                gam->lyapunovAccumulator[i] += alpha * ((growth / cycleTime) - gam->lyapunovAccumulator[i]);
+                estimate = gam->lyapunovAccumulator[i];
+            }
+        }
+        gam->lyapunovOutput[(permutation != NULL_PTR(const uint32 *)) ? (permutation[i]) : (i)] = estimate;
+    }
+}
+
+void LorenzAttractor::ResetLyapunov(const uint32 begin, const uint32 end) {
+    const uint32 n = maximumNumberOfNodes;
+    const float64 component = 1.0 / sqrt(3.0);
+    uint32 i;
+    for (i = begin; i < end; i++) {
+        uint32 c;
+        for (c = 0u; c < 3u; c++) {
+            tangent[0][(c * n) + i] = component;
+            tangent[1][(c * n) + i] = component;
+        }
+        lyapunovAccumulator[i] = 0.0;
+        lyapunovStartTime[i] = -1.0;
+    }
+}
+
+void LorenzAttractor::DetectJob(void * const context, const uint32 partition, const uint32 begin, const uint32 end) {
+    LorenzAttractor *gam = static_cast<LorenzAttractor *>(context);
+    const uint32 n = gam->maximumNumberOfNodes;
+    const float64 * const s0 = gam->previousState;
+    const float64 * const s1 = gam->state;
+    uint32 i;
+    for (i = begin; i < end; i++) {
+        uint32 f;
+        for (f = 0u; f < gam->numberOfEventFunctions; f++) {
+            const float64 * const plane = &gam->eventFunctions[4u * f];
+            const float64 g0 = (((plane[0u] * s0[i]) + (plane[1u] * s0[n + i])) + (plane[2u] * s0[(2u * n) + i])) - plane[3u];
+            const float64 g1 = (((plane[0u] * s1[i]) + (plane[1u] * s1[n + i])) + (plane[2u] * s1[(2u * n) + i])) - plane[3u];
+            if ((g0 < 0.0) != (g1 < 0.0)) {
+                gam->RecordCrossing(partition, i, plane, g0, g1, gam->eventFunctionTypes[f]);
+            }
+        }
+    }
+}
+
+void LorenzAttractor::RecordCrossing(const uint32 partition, const uint32 node, const float64 * const plane, const float64 g0, const float64 g1,
+                                     const int32 type) {
+    uint32 &count = partitionEventCount[partition];
+    // Refine the crossing time with the Hermite interpolant of the step
+    const uint32 n = maximumNumberOfNodes;
+    float64 f0[3];
+    float64 f1[3];
+    LorenzKernels::Parameters<float64> p = stageArguments.parameters;
+    if (nodeParameters != NULL_PTR(float64 *)) {
+        p.sigma = nodeParameters[node];
+        p.rho = nodeParameters[n + node];
+        p.beta = nodeParameters[(2u * n) + node];
+    }
+    LorenzKernels::ElementDerivative(p, stageArguments.coupling, previousState, n, node, f0[0u], f0[1u], f0[2u]);
+    LorenzKernels::ElementDerivative(p, stageArguments.coupling, state, n, node, f1[0u], f1[1u], f1[2u]);
+    const float64 gf0 = timeStep * (((plane[0u] * f0[0u]) + (plane[1u] * f0[1u])) + (plane[2u] * f0[2u]));
+    const float64 gf1 = timeStep * (((plane[0u] * f1[0u]) + (plane[1u] * f1[1u])) + (plane[2u] * f1[2u]));
+    const float64 theta = LorenzKernels::LocateCrossing(g0, gf0, g1, gf1);
+    const float64 eventTime = time + (theta * timeStep);
+    // The nodes are scanned in order within a step: once the buffer is full, keep the earliest events by replacing the latest
+    uint32 slot = (partition * eventCapacity) + count;
+    bool keep = (count < eventCapacity);
+    if (!keep) {
+        slot = partition * eventCapacity;
+        uint32 e;
+        for (e = 1u; e < eventCapacity; e++) {
+            if (partitionEventTimes[(partition * eventCapacity) + e] > partitionEventTimes[slot]) {
+                slot = (partition * eventCapacity) + e;
+            }
+        }
+        keep = (eventTime < partitionEventTimes[slot]);
+    }
+    if (keep) {
+        partitionEventTimes[slot] = eventTime;
+        partitionEventNodes[slot] = (coupled) ? (network.GetPermutation()[node]) : (node);
+        partitionEventTypes[slot] = (g0 < 0.0) ? (type) : (-type);
+    }
+    count++;
+}
+
+void LorenzAttractor::PublishEvents() {
+    // Keep the earliest eventCapacity events, sorted by time
+    uint32 total = 0u;
+    uint32 stored = 0u;
+    const uint32 numberOfPartitions = workers.GetNumberOfPartitions();
+    uint32 p;
+    for (p = 0u; p < numberOfPartitions; p++) {
+        const uint32 count = (partitionEventCount[p] < eventCapacity) ? (partitionEventCount[p]) : (eventCapacity);
+        uint32 e;
+        for (e = 0u; e < count; e++) {
+            const uint32 slot = (p * eventCapacity) + e;
+            const float64 eventTime = partitionEventTimes[slot];
+            uint32 k = (stored < eventCapacity) ? (stored) : (eventCapacity);
+            if ((k < eventCapacity) || (eventTime < eventTimesOutput[eventCapacity - 1u])) {
+                if (k == eventCapacity) {
+                    k--;
+                }
+                while ((k > 0u) && (eventTimesOutput[k - 1u] > eventTime)) {
+                    eventTimesOutput[k] = eventTimesOutput[k - 1u];
+                    eventNodesOutput[k] = eventNodesOutput[k - 1u];
+                    eventTypesOutput[k] = eventTypesOutput[k - 1u];
+                    k--;
+                }
+                eventTimesOutput[k] = eventTime;
+                eventNodesOutput[k] = partitionEventNodes[slot];
+                eventTypesOutput[k] = partitionEventTypes[slot];
+                if (stored < eventCapacity) {
+                    stored++;
+                }
+            }
+        }
+        total += partitionEventCount[p];
+        partitionEventCount[p] = 0u;
+    }
+    *eventCountOutput = total;
+}
+
+void LorenzAttractor::LogFormatter(void * const context, const LorenzLog::Record &record) {
+    const LorenzAttractor *gam = static_cast<const LorenzAttractor *>(context);
+    gam->FormatLogRecord(record);
+}
+
+void LorenzAttractor::FormatLogRecord(const LorenzLog::Record &record) const {
+    const char8 *signalName = "";
+    TypeDescriptor signalType = InvalidType;
+    if (record.index < numberOfLoggedSignals) {
+        signalName = signalNames[record.index].Buffer();
+        signalType = signalTypes[record.index];
+    }
+    if (record.code == static_cast<uint32>(LogSignalType)) {
+        REPORT_ERROR(ErrorManagement::Information, "Signal '%!' has type '%!'", signalName, TypeDescriptor::GetTypeNameFromTypeDescriptor(signalType));
+    }
+    else if ((record.code == static_cast<uint32>(LogSignalValue)) || (record.code == static_cast<uint32>(LogNewValue))) {
+        const AnyType value(signalType, 0u, &record.value);
+        const char8 * const what = (record.code == static_cast<uint32>(LogSignalValue)) ? ("has value") : ("new value");
+        if (record.numberOfElements > 1u) {
+            REPORT_ERROR(ErrorManagement::Information, "Signal '%!' %s '%!' (first of %u elements)", signalName, what, value, record.numberOfElements);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Information, "Signal '%!' %s '%!'", signalName, what, value);
+        }
+    }
+    else if (record.code == static_cast<uint32>(LogInvalidMessage)) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Message does not contain a ReferenceT<StructuredDataI>");
+    }
+    else if (record.code == static_cast<uint32>(LogInvalidSignal)) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "No valid signal name or index provided");
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Failed to read and apply new value of signal '%!'", signalName);
+    }
+}
+
+void LorenzAttractor::LogSignal(const LorenzLog::Level level, const LogCode code, const uint32 signalIndex) {
+    if (diagnostics.IsEnabled(level)) {
+        diagnostics.Add(level, static_cast<uint32>(code), signalIndex, signalElements[signalIndex], GetOutputSignalMemory(signalIndex),
+                        signalByteSizes[signalIndex]);
+    }
+}
+
+void LorenzAttractor::Step() {
+    if (singlePrecision) {
+        StepSinglePrecision();
+    }
+    else {
+        StepDoublePrecision();
+    }
+    time += timeStep;
+}
+
+void LorenzAttractor::StepSinglePrecision() {
+    const float32 *input = state32;
+    uint32 s;
+    for (s = 0u; s < tableau.numberOfStages; s++) {
+        stageKind = LorenzKernels::GetStageKind(s, tableau.numberOfStages, compensated);
+        stageArguments32.input = input;
+        stageArguments32.base = state32;
+        stageArguments32.output = stageBuffer32[s % 2u];
+        stageArguments32.advance = static_cast<float32>(tableau.advance[s]);
+        stageArguments32.weight = static_cast<float32>(tableau.weight[s]);
+        workers.Run(&SinglePrecisionStageJob, this);
+        input = stageArguments32.output;
+    }
+    const uint32 last = (tableau.numberOfStages - 1u) % 2u;
+    float32 * const previous = state32;
+    state32 = stageBuffer32[last];
+    stageBuffer32[last] = previous;
+}
+
+void LorenzAttractor::StepDoublePrecision() {
+    const float64 *input = state;
+    uint32 s;
+    for (s = 0u; s < tableau.numberOfStages; s++) {
+        stageKind = LorenzKernels::GetStageKind(s, tableau.numberOfStages);
+        stageArguments.input = input;
+        stageArguments.base = state;
+        stageArguments.output = stageBuffer[s % 2u];
+        stageArguments.accumulator = accumulator;
+        stageArguments.advance = tableau.advance[s];
+        stageArguments.weight = tableau.weight[s];
+        workers.Run(&StageJob, this);
+        input = stageArguments.output;
+    }
+    // The new state is in the last stage buffer: swap it with the state so that the state at the beginning of the step is kept
+    const uint32 last = (tableau.numberOfStages - 1u) % 2u;
+    previousState = state;
+    state = stageBuffer[last];
+    stageBuffer[last] = previousState;
+    if (lyapunovEnabled) {
+        workers.Run(&TangentJob, this);
+        float64 *previousTangent = tangent[0];
+        tangent[0] = tangent[1];
+        tangent[1] = previousTangent;
+    }
+    if (eventsEnabled) {
+        workers.Run(&DetectJob, this);
+    }
+}
+
+void LorenzAttractor::CommitReconfiguration() {
+    // Never wait for the message thread: if it holds the lock the commit is attempted again in the next cycle
+    if (reconfigurationSem.FastTryLock()) {
+        if (pendingState == ReconfigurationArmed) {
+            numberOfNodes = pending.numberOfNodes;
+            timeStep = pending.timeStep;
+            numberOfSubSteps = pending.numberOfSubSteps;
+            tableau = pending.tableau;
+            stageArguments.timeStep = timeStep;
+            stageArguments32.timeStep = static_cast<float32>(timeStep);
+            workers.SetNumberOfItems(numberOfNodes);
+            pendingState = ReconfigurationIdle;
+        }
+        reconfigurationSem.FastUnLock();
+    }
+}
+
+/*lint -e{715} the state names are not needed to arm the reconfiguration.*/
+bool LorenzAttractor::PrepareNextState(const char8 * const, const char8 * const) {
+    if (pendingState == ReconfigurationOnStateChange) {
+        if (reconfigurationSem.FastLock().ErrorsCleared()) {
+            if (pendingState == ReconfigurationOnStateChange) {
+                pendingState = ReconfigurationArmed;
+            }
+            reconfigurationSem.FastUnLock();
+        }
+    }
+    return true;
+}
+
 bool LorenzAttractor::Execute() {
+    if (modelEnabled) {
+        if (pendingState == ReconfigurationArmed) {
+            CommitReconfiguration();
+        }
+        cycleStartTime = time;
+        uint32 s;
+        for (s = 0u; s < numberOfSubSteps; s++) {
+            Step();
+        }
+        workers.Run(&PublishJob, this);
+        if (lyapunovEnabled) {
+            workers.Run(&LyapunovJob, this);
+        }
+        if (timeOutput != NULL_PTR(float64 *)) {
+            *timeOutput = time;
+        }
+        if (numberOfNodesOutput != NULL_PTR(uint32 *)) {
+            *numberOfNodesOutput = numberOfNodes;
+        }
+        if (sweepProgressOutput != NULL_PTR(uint32 *)) {
+            *sweepProgressOutput = sweep.GetCompletedPoints();
+        }
+        if (sweepStateOutput != NULL_PTR(uint32 *)) {
+            *sweepStateOutput = static_cast<uint32>(sweep.GetState());
+        }
+        if (eventsEnabled) {
+            PublishEvents();
+        }
+    }
     return true;
 }
 
@@ -184,7 +1469,7 @@ ErrorManagement::ErrorType LorenzAttractor::SetOutput(ReferenceContainer& messag
 
     if (!ok) {
         ret = ErrorManagement::ParametersError;
-        REPORT_ERROR(ret, "Message does not contain a ReferenceT<StructuredDataI>");
+        diagnostics.Add(LorenzLog::ErrorLevel, LogInvalidMessage, 0u, 0u, NULL_PTR(const void *), 0u);
     }
 
     StreamString signalName;
@@ -203,9 +1488,9 @@ ErrorManagement::ErrorType LorenzAttractor::SetOutput(ReferenceContainer& messag
         ok = (signalIndex < GetNumberOfOutputSignals());
     }
 
-    if (!ok) {
+    if ((!ok) && (ret.ErrorsCleared())) {
         ret = ErrorManagement::ParametersError;
-        REPORT_ERROR(ret, "No valid signal name or index provided");
+        diagnostics.Add(LorenzLog::ErrorLevel, LogInvalidSignal, signalIndex, 0u, NULL_PTR(const void *), 0u);
     }
 
     TypeDescriptor signalType = InvalidType;
@@ -236,11 +1521,11 @@ ErrorManagement::ErrorType LorenzAttractor::SetOutput(ReferenceContainer& messag
         }
 
         if (data->Read("SignalValue", signalNewValue)) {
-            REPORT_ERROR(ErrorManagement::Information, "Signal '%!' new value '%!'", signalName.Buffer(), signalNewValue);
+            LogSignal(LorenzLog::InformationLevel, LogNewValue, signalIndex);
         }
         else {
             ret = ErrorManagement::ParametersError;
-            REPORT_ERROR(ret, "Failed to read and apply new signal value");
+            diagnostics.Add(LorenzLog::ErrorLevel, LogInvalidValue, signalIndex, 0u, NULL_PTR(const void *), 0u);
         }
 
     }
@@ -248,10 +1533,194 @@ ErrorManagement::ErrorType LorenzAttractor::SetOutput(ReferenceContainer& messag
     return ret;
 }
 
+ErrorManagement::ErrorType LorenzAttractor::Reconfigure(ReferenceContainer& message) {
+
+    ErrorManagement::ErrorType ret = ErrorManagement::NoError;
+
+    bool ok = (message.Size() == 1u);
+    ReferenceT<StructuredDataI> data = message.Get(0u);
+
+    if (ok) {
+        ok = data.IsValid();
+    }
+
+    if (!ok) {
+        ret = ErrorManagement::ParametersError;
+        REPORT_ERROR(ret, "Message does not contain a ReferenceT<StructuredDataI>");
+    }
+
+    if ((ok) && (!modelEnabled)) {
+        ok = false;
+        ret = ErrorManagement::IllegalOperation;
+        REPORT_ERROR(ret, "Reconfigure requires the model to be enabled");
+    }
+
+    if (ok) {
+        ok = (reconfigurationSem.FastLock().ErrorsCleared());
+        if (!ok) {
+            ret = ErrorManagement::FatalError;
+            REPORT_ERROR(ret, "Failed to lock the reconfiguration semaphore");
+        }
+    }
+
+    if (ok) {
+        // The committed values are only modified by the real-time thread while holding the lock
+        Configuration next;
+        next.numberOfNodes = numberOfNodes;
+        next.timeStep = timeStep;
+        next.numberOfSubSteps = numberOfSubSteps;
+        next.tableau = tableau;
+        (void) data->Read("NumberOfNodes", next.numberOfNodes);
+        (void) data->Read("TimeStep", next.timeStep);
+        (void) data->Read("NumberOfSubSteps", next.numberOfSubSteps);
+        StreamString integrator;
+        if (data->Read("Integrator", integrator)) {
+            ok = LorenzKernels::GetTableau(integrator.Buffer(), next.tableau);
+        }
+        if (ok) {
+            ok = ((next.numberOfNodes > 0u) && (next.numberOfNodes <= maximumNumberOfNodes) && (next.timeStep > 0.0) && (next.numberOfSubSteps > 0u));
+        }
+        if ((ok) && (coupled)) {
+            ok = (next.numberOfNodes == numberOfNodes);
+        }
+        StreamString commit = "Cycle";
+        if (ok) {
+            (void) data->Read("Commit", commit);
+            ok = ((commit == "Cycle") || (commit == "StateChange"));
+        }
+        if (ok) {
+            // Prepare the nodes to be activated: the real-time thread never touches the inactive nodes of the state buffers
+            InitialiseNodes(numberOfNodes, next.numberOfNodes);
+            if (lyapunovEnabled) {
+                ResetLyapunov(numberOfNodes, next.numberOfNodes);
+            }
+            pending = next;
+            pendingState = (commit == "Cycle") ? (ReconfigurationArmed) : (ReconfigurationOnStateChange);
+        }
+        else {
+            ret = ErrorManagement::ParametersError;
+            REPORT_ERROR(ret, "Invalid reconfiguration: 0 < NumberOfNodes <= %u (unchanged if coupled), TimeStep > 0, NumberOfSubSteps > 0, "
+                         "Integrator in {RK4, Heun, Midpoint, Euler}, Commit in {Cycle, StateChange}", maximumNumberOfNodes);
+        }
+        reconfigurationSem.FastUnLock();
+    }
+
+    return ret;
+}
+
+ErrorManagement::ErrorType LorenzAttractor::Sweep(ReferenceContainer& message) {
+
+    ErrorManagement::ErrorType ret = ErrorManagement::NoError;
+
+    bool ok = (message.Size() == 1u);
+    ReferenceT<StructuredDataI> data = message.Get(0u);
+
+    if (ok) {
+        ok = data.IsValid();
+    }
+
+    if (!ok) {
+        ret = ErrorManagement::ParametersError;
+        REPORT_ERROR(ret, "Message does not contain a ReferenceT<StructuredDataI>");
+    }
+
+    if ((ok) && ((!modelEnabled) || (sweepCPUs == 0u))) {
+        ok = false;
+        ret = ErrorManagement::IllegalOperation;
+        REPORT_ERROR(ret, "Sweep requires the model to be enabled and SweepCPUs to be set");
+    }
+
+    LorenzSweep::Configuration configuration;
+    if (ok) {
+        // The committed values are only modified by the real-time thread while holding the lock
+        ok = (reconfigurationSem.FastLock().ErrorsCleared());
+        if (ok) {
+            configuration.timeStep = timeStep;
+            configuration.tableau = tableau;
+            reconfigurationSem.FastUnLock();
+        }
+        else {
+            ret = ErrorManagement::FatalError;
+            REPORT_ERROR(ret, "Failed to lock the reconfiguration semaphore");
+        }
+    }
+
+    if (ok) {
+        const char8 * const axisNames[3] = { "Sigma", "Rho", "Beta" };
+        const float64 modelValues[3] = { parameters.sigma, parameters.rho, parameters.beta };
+        uint32 a;
+        for (a = 0u; (a < 3u) && (ok); a++) {
+            LorenzSweep::Axis &axis = configuration.axes[a];
+            axis.from = modelValues[a];
+            axis.to = modelValues[a];
+            axis.points = 1u;
+            if (data->MoveRelative(axisNames[a])) {
+                ok = ((data->Read("From", axis.from)) && (data->Read("To", axis.to)) && (data->Read("Points", axis.points)));
+                (void) data->MoveToAncestor(1u);
+            }
+        }
+        if (ok) {
+            Vector<float64> initialStateVector(&configuration.initialState[0], 3u);
+            if (!data->Read("InitialState", initialStateVector)) {
+                configuration.initialState[0] = 1.0;
+                configuration.initialState[1] = 1.0;
+                configuration.initialState[2] = 1.0;
+            }
+            (void) data->Read("TimeStep", configuration.timeStep);
+            StreamString integrator;
+            if (data->Read("Integrator", integrator)) {
+                ok = LorenzKernels::GetTableau(integrator.Buffer(), configuration.tableau);
+            }
+        }
+        if (ok) {
+            if (!data->Read("TransientTime", configuration.transientTime)) {
+                configuration.transientTime = 10.0;
+            }
+            if (!data->Read("MeasurementTime", configuration.measurementTime)) {
+                configuration.measurementTime = 50.0;
+            }
+            if (!data->Read("NumberOfThreads", configuration.numberOfThreads)) {
+                configuration.numberOfThreads = 1u;
+            }
+            ok = data->Read("File", configuration.fileName);
+        }
+        configuration.cpuMask = sweepCPUs;
+        configuration.reservedCPUs = (workerCPUs | realTimeCPUs);
+        if (ok) {
+            ok = sweep.Start(configuration);
+        }
+        if (!ok) {
+            ret = ErrorManagement::ParametersError;
+            REPORT_ERROR(ret, "Invalid sweep: the axes need From, To and Points, the Integrator shall be in {RK4, Heun, Midpoint, Euler}, "
+                         "File shall be set and no other sweep shall be running");
+        }
+    }
+
+    return ret;
+}
+
+ErrorManagement::ErrorType LorenzAttractor::CancelSweep(ReferenceContainer&) {
+    sweep.Cancel();
+    return ErrorManagement::NoError;
+}
+
+void LorenzAttractor::StopDiagnostics() {
+    diagnostics.Stop();
+}
+
 CLASS_REGISTER(LorenzAttractor, "1.0")
 
 /*lint -e{1023} Justification: Macro provided by the Core.*/
 CLASS_METHOD_REGISTER(LorenzAttractor, SetOutput)
 
+/*lint -e{1023} Justification: Macro provided by the Core.*/
+CLASS_METHOD_REGISTER(LorenzAttractor, Reconfigure)
+
+/*lint -e{1023} Justification: Macro provided by the Core.*/
+CLASS_METHOD_REGISTER(LorenzAttractor, Sweep)
+
+/*lint -e{1023} Justification: Macro provided by the Core.*/
+CLASS_METHOD_REGISTER(LorenzAttractor, CancelSweep)
+
 } /* namespace MARTe */
 
@@ -39,8 +39,17 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "FastPollingMutexSem.h"
 #include "GAM.h"
 #include "MessageI.h"
+#include "StreamString.h"
+#include "LorenzArena.h"
+#include "LorenzArrayFile.h"
+#include "LorenzKernels.h"
+#include "LorenzLog.h"
+#include "LorenzNetwork.h"
+#include "LorenzSweep.h"
+#include "LorenzWorkerPool.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -49,52 +58,112 @@
 namespace MARTe {
 
 /**
- * @brief GAM which provides constant output signals. 
- * @details This GAM provides constant output signals, the value of which is defined through configuration, and
- * may be asynchronously altered using MARTe messages sent e.g. from a StateMachine.
+ * @brief GAM which integrates a network of (optionally coupled) Lorenz systems.
+ * @details At every cycle the NumberOfNodes active nodes are advanced by NumberOfSubSteps steps of an explicit
+ * Runge-Kutta scheme and the state of node i is published in element i of the float64 output signals X, Y and Z.
+ * The number of elements of X, Y and Z is the capacity: all the memory is allocated for it at Setup(), in a single
+ * LorenzArena, and nothing is allocated afterwards. Any other output signal is a constant which keeps its Default
+ * value until it is changed by a SetOutput message.
+ *
+ * Model. The nodes are integrated in structure-of-arrays form by the LorenzKernels, either in float64 or (Precision)
+ * in float32, optionally with compensated summation of the step increments. The coupling is diffusive on x,
+ * dx_i/dt += Strength * sum_j(A_ij * (x_j - x_i)), with A stored in CSR after an optional reverse Cuthill-McKee
+ * renumbering (the outputs keep the configured node order). The work can be shared with NumberOfWorkers threads
+ * pinned on the WorkerCPUs (LorenzWorkerPool); the real-time thread integrates partition 0.
+ *
+ * Initial conditions. The Default values of X, Y and Z, or (InitialConditions) a memory-mapped LorenzArrayFile with
+ * one record per node (X, Y, Z and optionally per-node Sigma, Rho and Beta, not supported with Coupling) or a seeded
+ * LorenzRandom sample, uniform in a box or Gaussian.
+ *
+ * Observables. The optional output signals Time, NumberOfNodes, Lyapunov (largest exponent of each node, not
+ * supported with Coupling), EventCount/EventTimes/EventNodes/EventTypes (lobe switches and plane crossings, timed
+ * with the cubic Hermite interpolant of the step, sorted by time) and SweepProgress/SweepState. Lyapunov and Events
+ * require Precision = Float64.
+ *
+ * Messages. SetOutput changes a constant output signal. Reconfigure changes NumberOfNodes, Integrator, TimeStep and
+ * NumberOfSubSteps; the request is validated by the message thread and committed by the real-time thread, which never
+ * waits for it, at the next cycle (Commit = Cycle) or after the next state change (Commit = StateChange). Sweep and
+ * CancelSweep run and cancel a LorenzSweep (bifurcation diagram written to a LorenzArrayFile) on the SweepCPUs, which
+ * shall not overlap the declared RealTimeCPUs nor the WorkerCPUs.
+ *
+ * Diagnostics. The Setup() values and the SetOutput changes and rejections are queued in a LorenzLog and reported,
+ * deduplicated and rate limited, by a background thread.
+ *
+ * Memory. The arena is backed by huge pages where available and placed at Setup(): the pages of each worker partition
+ * are first touched by its worker, those of partition 0 by a thread pinned on the RealTimeCPUs (by the thread calling
+ * Setup() if they are not declared) and the remaining ones (nodes beyond NumberOfNodes) by the thread calling Setup().
+ * The arena is then locked, so that Execute() never takes a page fault.
  *
  * The configuration syntax is (names and signal quantity are only given as an example):
  *
  * <pre>
- * +Constants = {
+ * +Network = {
  *     Class = LorenzAttractor
- *     OutputSignals = {
- *         Signal1 = {
- *             DataSource = "DDB"
- *             Type = uint32
- *             Default = 0
- *         }
- *         Signal2 = {
- *             DataSource = "DDB"
- *             Type = int32
- *             Default = 100
- *         }
- *         Signal3 = {
- *             DataSource = "DDB"
- *             Type = int8
- *             NumberOfDimensions = 1
- *             NumberOfElements = 8
- *             Default = {1 2 3 4 5 6 7 8}
+ *     TimeStep = 0.0001 // Optional. Integration step in seconds. If not set the model is disabled (constants only).
+ *     NumberOfSubSteps = 10 // Optional. Default = 1.
+ *     Integrator = RK4 // Optional. RK4, Heun, Midpoint or Euler. Default = RK4.
+ *     Sigma = 10.0 // Optional. Default = 10.
+ *     Rho = 28.0 // Optional. Default = 28.
+ *     Beta = 2.666667 // Optional. Default = 8/3.
+ *     NumberOfNodes = 4 // Optional. <= capacity (= capacity if coupled). Default = capacity.
+ *     Precision = Float64 // Optional. Float64, Float32 or Float32Compensated. Default = Float64.
+ *     NumberOfWorkers = 2 // Optional. Default = 0.
+ *     WorkerCPUs = 0x6 // Optional (compulsory with SweepCPUs and NumberOfWorkers > 0). Default = 0 (not pinned: they yield).
+ *     RealTimeCPUs = 0x1 // Optional (compulsory with SweepCPUs). The CPUs of the RealTimeThread executing the GAM. Default = 0.
+ *     SweepCPUs = 0x30 // Optional. CPUs of the sweep threads. Default = 0 (Sweep refused).
+ *     Coupling = { // Optional.
+ *         Strength = 0.5
+ *         Rows = {0 1 2 3} // Node receiving the coupling of each edge.
+ *         Columns = {1 2 3 0} // Node providing the coupling of each edge.
+ *         Weights = {1.0 1.0 1.0 1.0} // Optional. Default = 1.
+ *         Reordering = RCM // Optional. RCM or None. Default = RCM.
+ *     }
+ *     InitialConditions = { // Optional. Default = the Default values of X, Y and Z (which may then be omitted).
+ *         Source = UniformBox // File (File = "ensemble.bin"), UniformBox (Minimum, Maximum) or GaussianBall (Center, StandardDeviation).
+ *         Minimum = {-20.0 -25.0 0.0}
+ *         Maximum = {20.0 25.0 50.0}
+ *         Seed = 1 // Optional. Default = 1.
+ *     }
+ *     Lyapunov = { // Optional.
+ *         TimeConstant = 10.0 // Optional. Seconds of the moving average. Default = 0 (average since activation).
+ *     }
+ *     Events = { // Optional.
+ *         LobeSwitches = 1 // Optional. Crossings of x = 0 (event type 1). Default = 1.
+ *         Planes = { // Optional. The k-th plane has event type k + 2.
+ *             Poincare = { Normal = {0.0 0.0 1.0} Offset = 27.0 }
  *         }
  *     }
+ *     Diagnostics = { // Optional.
+ *         Verbosity = 2 // Optional. 0 (none), 1 (rejected messages) or 2 (also the values). Default = 2.
+ *         Rate = 100 // Optional. Records per second. Default = 100.
+ *         Burst = 50 // Optional. Default = 50.
+ *         Capacity = 256 // Optional. Queue capacity. Default = 256.
+ *         CPUs = 0x1 // Optional. Default = 0 (not pinned).
+ *     }
+ *     Memory = { // Optional.
+ *         HugePages = 1 // Optional. Default = 1.
+ *         Lock = 1 // Optional. A failure is only reported as a warning. Default = 1.
+ *     }
+ *     OutputSignals = {
+ *         X = { DataSource = DDB Type = float64 NumberOfElements = 4 Default = {1.0 1.1 1.2 1.3} }
+ *         Y = { DataSource = DDB Type = float64 NumberOfElements = 4 Default = {1.0 1.0 1.0 1.0} }
+ *         Z = { DataSource = DDB Type = float64 NumberOfElements = 4 Default = {1.0 1.0 1.0 1.0} }
+ *         Time = { DataSource = DDB Type = float64 } // Optional. Model time at the end of the cycle.
+ *         EventCount = { DataSource = DDB Type = uint32 } // Optional (with Events). May exceed the capacity below.
+ *         EventTimes = { DataSource = DDB Type = float64 NumberOfElements = 16 } // +EventNodes (uint32), EventTypes (int32, sign = direction).
+ *         Gain = { DataSource = DDB Type = float64 Default = 1.0 } // A constant.
+ *     }
  * }
- * </pre>
- *
- * The GAM registers a messageable 'SetOutput' method which allows to update signals through messages:
- *
- * <pre>
  * +Message = {
  *     Class = Message
- *     Destination = "Functions.Constants"
- *     Function = "SetOutput"
- *     +Parameters = {
- *         Class = ConfigurationDatabase
- *         SignalName = "Signal1" // The name of the signal to modify, or
- *         SignalIndex = 0 // Alternatively, the index of the signal.
- *         SignalValue = 10
- *     }
+ *     Destination = "Functions.Network"
+ *     Function = "Reconfigure" // Parameters: NumberOfNodes, Integrator, TimeStep, NumberOfSubSteps, Commit.
+ *     +Parameters = { Class = ConfigurationDatabase NumberOfNodes = 2 Commit = StateChange }
  * }
  * </pre>
+ *
+ * SetOutput takes SignalName (or SignalIndex) and SignalValue; Sweep takes File and, optionally, the Sigma, Rho and
+ * Beta axes ({From To Points}), InitialState, TimeStep, Integrator, TransientTime, MeasurementTime and NumberOfThreads.
  */
 class LorenzAttractor: public GAM, public MessageI {
 public:
@@ -106,10 +175,21 @@ public:
     LorenzAttractor();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Stops the workers and frees the state memory.
      */
     virtual ~LorenzAttractor();
 
+    /**
+     * @brief Reads the model and coupling parameters.
+     * @return true if GAM::Initialise succeeds and the parameters are consistent.
+     * @pre
+     *   TimeStep > 0 (if set) &&
+     *   (SweepCPUs == 0 || (RealTimeCPUs != 0 && (NumberOfWorkers == 0 || WorkerCPUs != 0) && (SweepCPUs & (WorkerCPUs | RealTimeCPUs)) == 0)) &&
+     *   Coupling.Rows, Coupling.Columns and Coupling.Weights (if set) have the same number of elements &&
+     *   !(Lyapunov && Coupling).
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
     /**
      * @brief Initialises the output signal memory with default values provided through configuration.
      * @return true if the pre-conditions are met.
@@ -120,7 +200,13 @@ public:
     virtual bool Setup();
 
     /**
-     * @brief Execute method. NOOP.
+     * @brief Arms a pending reconfiguration with Commit = StateChange.
+     * @return true.
+     */
+    virtual bool PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName);
+
+    /**
+     * @brief Execute method. Integrates NumberOfSubSteps steps (if the model is enabled) and publishes the state.
      * @return true.
      */
     virtual bool Execute();
@@ -138,6 +224,677 @@ public:
      *   The 'SignalValue' provided corresponds to the expected type and dimensionality.
      */
     ErrorManagement::ErrorType SetOutput(ReferenceContainer& message);
+
+    /**
+     * @brief Reconfigure method.
+     * @details The method is registered as a messageable function. It assumes the ReferenceContainer
+     * includes a reference to a StructuredDataI instance with any of the NumberOfNodes, Integrator, TimeStep,
+     * NumberOfSubSteps and Commit attributes. The new configuration is committed by the real-time thread.
+     * @return ErrorManagement::NoError if the pre-conditions are met, ErrorManagement::ParametersError
+     * otherwise (ErrorManagement::IllegalOperation if the model is not enabled).
+     * @pre
+     *   0 < NumberOfNodes <= capacity && (!coupled || NumberOfNodes is unchanged) &&
+     *   TimeStep > 0 && NumberOfSubSteps > 0
+     */
+    ErrorManagement::ErrorType Reconfigure(ReferenceContainer& message);
+
+    /**
+     * @brief Sweep method.
+     * @details The method is registered as a messageable function. It assumes the ReferenceContainer
+     * includes a reference to a StructuredDataI instance with the File attribute and, optionally, the Sigma, Rho
+     * and Beta axes (From, To and Points), InitialState, TimeStep, Integrator, TransientTime, MeasurementTime
+     * and NumberOfThreads. The sweep runs in background and the method returns immediately.
+     * @return ErrorManagement::NoError if the sweep was started, ErrorManagement::ParametersError if the
+     * parameters are invalid and ErrorManagement::IllegalOperation if the model is not enabled, SweepCPUs
+     * is not set or a sweep is already running.
+     */
+    ErrorManagement::ErrorType Sweep(ReferenceContainer& message);
+
+    /**
+     * @brief CancelSweep method.
+     * @details The method is registered as a messageable function. Requests the cancellation of the running
+     * sweep, if any (the message needs no parameters).
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType CancelSweep(ReferenceContainer& message);
+
+protected:
+
+    /**
+     * @brief Reports the queued diagnostics and stops the diagnostics thread (see LorenzLog::Stop).
+     * @details Returns once the records are reported. The later diagnostics are discarded until the next Setup().
+     */
+    void StopDiagnostics();
+
+private:
+
+    /**
+     * @brief Codes of the diagnostics records.
+     */
+    enum LogCode {
+        /** Type of the output signal index (Setup). */
+        LogSignalType = 1,
+        /** Value of the output signal index (Setup). */
+        LogSignalValue = 2,
+        /** New value of the output signal index (SetOutput). */
+        LogNewValue = 3,
+        /** SetOutput without a StructuredDataI. */
+        LogInvalidMessage = 4,
+        /** SetOutput without a valid signal name or index (index holds the index, if any). */
+        LogInvalidSignal = 5,
+        /** SetOutput with a SignalValue which could not be read. */
+        LogInvalidValue = 6
+    };
+
+    /**
+     * @brief Origin of the initial conditions.
+     */
+    enum InitialConditionsSource {
+        /** The Default values of X, Y and Z. */
+        DefaultInitialConditions = 0,
+        /** A LorenzArrayFile. */
+        FileInitialConditions = 1,
+        /** Uniform in a box. */
+        UniformBoxInitialConditions = 2,
+        /** Isotropic Gaussian. */
+        GaussianBallInitialConditions = 3
+    };
+
+    /**
+     * @brief The parameters which can be changed by Reconfigure.
+     */
+    struct Configuration {
+        uint32 numberOfNodes;
+        float64 timeStep;
+        uint32 numberOfSubSteps;
+        LorenzKernels::Tableau tableau;
+    };
+
+    /**
+     * @brief State of the pending reconfiguration.
+     */
+    enum ReconfigurationState {
+        /** No reconfiguration pending. */
+        ReconfigurationIdle = 0,
+        /** Waiting for the next PrepareNextState. */
+        ReconfigurationOnStateChange = 1,
+        /** To be committed at the next cycle boundary. */
+        ReconfigurationArmed = 2
+    };
+
+    /**
+     * @brief Commits the pending reconfiguration, if the lock can be taken without waiting.
+     */
+    void CommitReconfiguration();
+
+    /**
+     * @brief Sets up the state memory, the coupling and the workers of the model.
+     */
+    bool SetupModel();
+
+    /**
+     * @brief Carves all the arrays of the model out of the arena and places them (see LorenzArena).
+     */
+    bool SetupArena();
+
+    /**
+     * @brief Opens and validates the initial conditions file (Source = File).
+     */
+    bool OpenInitialConditions();
+
+    /**
+     * @brief Writes the initial conditions (file or generator) to the X, Y and Z output signals and the per-node parameters, if any.
+     */
+    void LoadInitialConditions();
+
+    /**
+     * @brief LorenzWorkerPool job which first touches the arena memory of the nodes [begin, end) and of the partition.
+     */
+    static void TouchJob(void * const context, const uint32 partition, const uint32 begin, const uint32 end);
+
+    /**
+     * @brief Touches the arena memory of partition 0 from a transient thread pinned on the RealTimeCPUs and waits for it.
+     * @pre RealTimeCPUs != 0.
+     */
+    bool PlacePartitionZero();
+
+    /**
+     * @brief Body of the thread launched by PlacePartitionZero().
+     */
+    static void PlacementThread(const void * const arguments);
+
+    /**
+     * @brief Integrates one time step.
+     */
+    void Step();
+
+    /**
+     * @brief Integrates one time step of the float32 state.
+     */
+    void StepSinglePrecision();
+
+    /**
+     * @brief Integrates one time step of the float64 state, the tangent vectors and the events.
+     */
+    void StepDoublePrecision();
+
+    /**
+     * @brief LorenzWorkerPool job which runs the current stage on [begin, end).
+     */
+    static void StageJob(void * const context, const uint32 partition, const uint32 begin, const uint32 end);
+
+    /**
+     * @brief LorenzWorkerPool job which runs the current float32 stage on [begin, end).
+     */
+    static void SinglePrecisionStageJob(void * const context, const uint32 partition, const uint32 begin, const uint32 end);
+
+    /**
+     * @brief Sets the nodes [begin, end) of all the state buffers to their initial conditions.
+     */
+    void InitialiseNodes(const uint32 begin, const uint32 end);
+
+    /**
+     * @brief LorenzWorkerPool job which copies the state of the nodes [begin, end) to the output signals.
+     */
+    static void PublishJob(void * const context, const uint32 partition, const uint32 begin, const uint32 end);
+
+    /**
+     * @brief LorenzWorkerPool job which advances the tangent vectors of the nodes [begin, end) over the last step.
+     */
+    static void TangentJob(void * const context, const uint32 partition, const uint32 begin, const uint32 end);
+
+    /**
+     * @brief LorenzWorkerPool job which renormalises the tangent vectors of the nodes [begin, end) and publishes the Lyapunov estimates.
+     */
+    static void LyapunovJob(void * const context, const uint32 partition, const uint32 begin, const uint32 end);
+
+    /**
+     * @brief Resets the tangent vectors and the Lyapunov estimates of the nodes [begin, end).
+     */
+    void ResetLyapunov(const uint32 begin, const uint32 end);
+
+    /**
+     * @brief LorenzWorkerPool job which detects the events of the nodes [begin, end) in the last step.
+     */
+    static void DetectJob(void * const context, const uint32 partition, const uint32 begin, const uint32 end);
+
+    /**
+     * @brief Refines the time of a crossing of \a node and stores it in the buffer of \a partition.
+     * @details Once the buffer holds eventCapacity events, the event replaces the latest one if it is earlier, so that
+     * the buffer holds the earliest events of the partition. The count of the partition includes every crossing.
+     */
+    void RecordCrossing(const uint32 partition, const uint32 node, const float64 * const plane, const float64 g0, const float64 g1, const int32 type);
+
+    /**
+     * @brief Merges the events of all the partitions into the output signals.
+     */
+    void PublishEvents();
+
+    /**
+     * @brief LorenzLog::FormatterFunction which calls FormatLogRecord.
+     */
+    static void LogFormatter(void * const context, const LorenzLog::Record &record);
+
+    /**
+     * @brief Reports a diagnostics record (called by the log thread).
+     */
+    void FormatLogRecord(const LorenzLog::Record &record) const;
+
+    /**
+     * @brief Queues a diagnostics record with the first element of the output signal \a signalIndex.
+     */
+    void LogSignal(const LorenzLog::Level level, const LogCode code, const uint32 signalIndex);
+
+    /**
+     * True if a TimeStep was configured.
+     */
+    bool modelEnabled;
+
+    /**
+     * The model parameters.
+     */
+    LorenzKernels::Parameters<float64> parameters;
+
+    /**
+     * The integration time step.
+     */
+    float64 timeStep;
+
+    /**
+     * Integration steps per Execute.
+     */
+    uint32 numberOfSubSteps;
+
+    /**
+     * The integration scheme.
+     */
+    LorenzKernels::Tableau tableau;
+
+    /**
+     * Number of integrated nodes.
+     */
+    uint32 numberOfNodes;
+
+    /**
+     * Capacity (elements of the X, Y and Z signals), which is also the stride of the state buffers.
+     */
+    uint32 maximumNumberOfNodes;
+
+    /**
+     * Output signal memory of X, Y and Z.
+     */
+    float64 *outputState[3];
+
+    /**
+     * The three state/stage buffers (structure-of-arrays, internal node order), which rotate between
+     * state and stageBuffer.
+     */
+    float64 *stateBuffers[3];
+
+    /**
+     * Integrated state.
+     */
+    float64 *state;
+
+    /**
+     * Stage buffers.
+     */
+    float64 *stageBuffer[2];
+
+    /**
+     * Runge-Kutta accumulator.
+     */
+    float64 *accumulator;
+
+    /**
+     * True if the state is stored and integrated in float32 (the float64 state buffers are then not allocated).
+     */
+    bool singlePrecision;
+
+    /**
+     * True if the float32 state is updated with compensated summation.
+     */
+    bool compensated;
+
+    /**
+     * The float32 state/stage buffers, as stateBuffers.
+     */
+    float32 *stateBuffers32[3];
+
+    /**
+     * Integrated float32 state.
+     */
+    float32 *state32;
+
+    /**
+     * Float32 stage buffers.
+     */
+    float32 *stageBuffer32[2];
+
+    /**
+     * Float32 Runge-Kutta accumulator.
+     */
+    float32 *accumulator32;
+
+    /**
+     * Rounding error of the last update of each float32 state element (Float32Compensated).
+     */
+    float32 *compensation;
+
+    /**
+     * Initial conditions of all the nodes.
+     */
+    float64 *initialState;
+
+    /**
+     * An InitialConditionsSource.
+     */
+    uint32 initialConditionsSource;
+
+    /**
+     * Path of the initial conditions file.
+     */
+    StreamString initialConditionsFileName;
+
+    /**
+     * The initial conditions file (only mapped during Setup).
+     */
+    LorenzArrayFile initialConditionsFile;
+
+    /**
+     * Seed of the initial conditions generators.
+     */
+    uint32 initialConditionsSeed;
+
+    /**
+     * Lower corner of the box (UniformBox) or center (GaussianBall).
+     */
+    float64 generatorOrigin[3];
+
+    /**
+     * Size of the box (UniformBox) or standard deviation in each component (GaussianBall).
+     */
+    float64 generatorExtent[3];
+
+    /**
+     * True if the initial conditions file has per-node parameters.
+     */
+    bool nodeParametersEnabled;
+
+    /**
+     * Per-node sigma[0..n), rho[n..2n) and beta[2n..3n) (see LorenzKernels::StageArguments).
+     */
+    float64 *nodeParameters;
+
+    /**
+     * Per-node parameters of the float32 state.
+     */
+    float32 *nodeParameters32;
+
+    /**
+     * Protects the pending reconfiguration.
+     */
+    FastPollingMutexSem reconfigurationSem;
+
+    /**
+     * The pending reconfiguration.
+     */
+    Configuration pending;
+
+    /**
+     * A ReconfigurationState.
+     */
+    volatile int32 pendingState;
+
+    /**
+     * Optional NumberOfNodes output signal.
+     */
+    uint32 *numberOfNodesOutput;
+
+    /**
+     * True if the Lyapunov estimator is configured.
+     */
+    bool lyapunovEnabled;
+
+    /**
+     * Time constant of the Lyapunov moving average (0 for the average since activation).
+     */
+    float64 lyapunovTimeConstant;
+
+    /**
+     * Tangent vectors (current and next), with the same layout as the state.
+     */
+    float64 *tangent[2];
+
+    /**
+     * Sum of the log growths or moving average, per node.
+     */
+    float64 *lyapunovAccumulator;
+
+    /**
+     * Time at which the estimate of each node started (< 0 until the first renormalisation).
+     */
+    float64 *lyapunovStartTime;
+
+    /**
+     * Lyapunov output signal.
+     */
+    float64 *lyapunovOutput;
+
+    /**
+     * Model time at the beginning of the current cycle.
+     */
+    float64 cycleStartTime;
+
+    /**
+     * Arguments of the stage being executed.
+     */
+    LorenzKernels::StageArguments<float64> stageArguments;
+
+    /**
+     * Arguments of the float32 stage being executed.
+     */
+    LorenzKernels::StageArguments<float32> stageArguments32;
+
+    /**
+     * Kind of the stage being executed.
+     */
+    LorenzKernels::StageKind stageKind;
+
+    /**
+     * True if a Coupling was configured.
+     */
+    bool coupled;
+
+    /**
+     * Coupling strength.
+     */
+    float64 couplingStrength;
+
+    /**
+     * Reorder the nodes with reverse Cuthill-McKee.
+     */
+    bool reorderNodes;
+
+    /**
+     * Number of configured edges.
+     */
+    uint32 numberOfEdges;
+
+    /**
+     * Configured edges (only held between Initialise and Setup).
+     */
+    uint32 *edgeRows;
+
+    /**
+     * Configured edges (only held between Initialise and Setup).
+     */
+    uint32 *edgeColumns;
+
+    /**
+     * Configured edge weights (only held between Initialise and Setup).
+     */
+    float64 *edgeWeights;
+
+    /**
+     * The coupling matrix.
+     */
+    LorenzNetwork network;
+
+    /**
+     * Number of worker threads.
+     */
+    uint32 numberOfWorkers;
+
+    /**
+     * CPU mask of the workers.
+     */
+    uint32 workerCPUs;
+
+    /**
+     * The workers.
+     */
+    LorenzWorkerPool workers;
+
+    /**
+     * Holds all the arrays of the model.
+     */
+    LorenzArena arena;
+
+    /**
+     * True if the arena shall be backed by huge pages.
+     */
+    bool arenaHugePages;
+
+    /**
+     * True if the arena shall be locked in memory.
+     */
+    bool arenaLock;
+
+    /**
+     * Set by the PlacementThread() once the pages of partition 0 are touched.
+     */
+    volatile int32 partitionZeroPlaced;
+
+    /**
+     * CPU mask of the sweep threads.
+     */
+    uint32 sweepCPUs;
+
+    /**
+     * CPU mask of the RealTimeThread executing the GAM.
+     */
+    uint32 realTimeCPUs;
+
+    /**
+     * The background parameter sweep.
+     */
+    LorenzSweep sweep;
+
+    /**
+     * Optional SweepProgress output signal.
+     */
+    uint32 *sweepProgressOutput;
+
+    /**
+     * Optional SweepState output signal.
+     */
+    uint32 *sweepStateOutput;
+
+    /**
+     * Model time at the beginning of the next step.
+     */
+    float64 time;
+
+    /**
+     * Optional Time output signal.
+     */
+    float64 *timeOutput;
+
+    /**
+     * State at the beginning of the last step.
+     */
+    float64 *previousState;
+
+    /**
+     * True if Events are configured.
+     */
+    bool eventsEnabled;
+
+    /**
+     * Number of event planes (including the lobe switch).
+     */
+    uint32 numberOfEventFunctions;
+
+    /**
+     * Event planes (normal x, normal y, normal z, offset).
+     */
+    float64 *eventFunctions;
+
+    /**
+     * Event type of each plane.
+     */
+    int32 *eventFunctionTypes;
+
+    /**
+     * Number of elements of the event signals.
+     */
+    uint32 eventCapacity;
+
+    /**
+     * EventCount output signal.
+     */
+    uint32 *eventCountOutput;
+
+    /**
+     * EventTimes output signal.
+     */
+    float64 *eventTimesOutput;
+
+    /**
+     * EventNodes output signal.
+     */
+    uint32 *eventNodesOutput;
+
+    /**
+     * EventTypes output signal.
+     */
+    int32 *eventTypesOutput;
+
+    /**
+     * Number of events detected by each partition in the current cycle.
+     */
+    uint32 *partitionEventCount;
+
+    /**
+     * Event times stored by each partition (eventCapacity per partition).
+     */
+    float64 *partitionEventTimes;
+
+    /**
+     * Event nodes stored by each partition.
+     */
+    uint32 *partitionEventNodes;
+
+    /**
+     * Event types stored by each partition.
+     */
+    int32 *partitionEventTypes;
+
+    /**
+     * Diagnostics verbosity (see LorenzLog::Level).
+     */
+    uint32 logVerbosity;
+
+    /**
+     * Diagnostics records per second.
+     */
+    uint32 logRate;
+
+    /**
+     * Diagnostics burst.
+     */
+    uint32 logBurst;
+
+    /**
+     * Diagnostics queue capacity.
+     */
+    uint32 logCapacity;
+
+    /**
+     * CPU mask of the log thread.
+     */
+    uint32 logCPUs;
+
+    /**
+     * The diagnostics queue.
+     */
+    LorenzLog diagnostics;
+
+    /**
+     * Number of elements of signalNames, signalTypes, signalElements and signalByteSizes.
+     */
+    uint32 numberOfLoggedSignals;
+
+    /**
+     * Name of each output signal (read by the log thread instead of the GAM signal database).
+     */
+    StreamString *signalNames;
+
+    /**
+     * Type of each output signal.
+     */
+    TypeDescriptor *signalTypes;
+
+    /**
+     * Number of elements of each output signal.
+     */
+    uint32 *signalElements;
+
+    /**
+     * Byte size of each output signal.
+     */
+    uint32 *signalByteSizes;
 };
 
 }
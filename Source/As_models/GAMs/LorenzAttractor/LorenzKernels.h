@@ -0,0 +1,510 @@
+/**
+ * @file LorenzKernels.h
+ * @brief Header file for the LorenzKernels integration kernels
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This header file contains the structure-of-arrays kernels used to
+ * integrate ensembles (or networks) of Lorenz systems. The kernels are header-only
+ * templates so that they can be shared by any component that needs the Lorenz
+ * dynamics.
+ */
+
+#ifndef LORENZKERNELS_H_
+#define LORENZKERNELS_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "StringHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+namespace LorenzKernels {
+
+/**
+ * @brief The Lorenz model parameters.
+ */
+template<typename T>
+struct Parameters {
+    T sigma;
+    T rho;
+    T beta;
+};
+
+/**
+ * @brief Read-only view of a diffusive coupling matrix stored in CSR format.
+ * @details The coupling term added to the x derivative of node i is
+ * strength * sum_j(A_ij * (x_j - x_i)), i.e. strength * ((A x)_i - degree_i * x_i).
+ */
+struct CouplingView {
+    const uint32 *rowStart;
+    const uint32 *columns;
+    const float64 *weights;
+    const float64 *degree;
+    float64 strength;
+};
+
+/**
+ * @brief Explicit Runge-Kutta tableau where each stage only depends on the previous one.
+ * @details advance[s] is the fraction of the time step used to build the input of stage s+1 from
+ * the derivative of stage s; weight[s] is the weight of stage s in the final update.
+ */
+struct Tableau {
+    uint32 numberOfStages;
+    float64 advance[4];
+    float64 weight[4];
+};
+
+/**
+ * Classical fourth order Runge-Kutta.
+ */
+static const Tableau RungeKutta4 = { 4u, { 0.5, 0.5, 1.0, 0.0 }, { 1.0 / 6.0, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 6.0 } };
+
+/**
+ * Forward Euler.
+ */
+static const Tableau Euler = { 1u, { 0.0, 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0, 0.0 } };
+
+/**
+ * Explicit midpoint (second order).
+ */
+static const Tableau Midpoint = { 2u, { 0.5, 0.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0, 0.0 } };
+
+/**
+ * Heun (second order).
+ */
+static const Tableau Heun = { 2u, { 1.0, 0.0, 0.0, 0.0 }, { 0.5, 0.5, 0.0, 0.0 } };
+
+/**
+ * @brief Gets the tableau of the integrator with the given name (RK4, Heun, Midpoint or Euler).
+ * @return false if the name is not known.
+ */
+inline bool GetTableau(const char8 * const name, Tableau &tableau) {
+    bool ok = true;
+    if (StringHelper::Compare(name, "RK4") == 0) {
+        tableau = RungeKutta4;
+    }
+    else if (StringHelper::Compare(name, "Heun") == 0) {
+        tableau = Heun;
+    }
+    else if (StringHelper::Compare(name, "Midpoint") == 0) {
+        tableau = Midpoint;
+    }
+    else if (StringHelper::Compare(name, "Euler") == 0) {
+        tableau = Euler;
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+/**
+ * @brief Role of a stage inside a step.
+ */
+enum StageKind {
+    /** First stage of a multi-stage method: initialises the accumulator. */
+    FirstStage,
+    /** Any stage which is neither the first nor the last. */
+    IntermediateStage,
+    /** Last stage of a multi-stage method: writes the new state into the output. */
+    FinalStage,
+    /** Single stage method: writes base + h * k into the output. */
+    SingleStage,
+    /** FinalStage with the update added to the base by compensated (Kahan) summation. */
+    CompensatedFinalStage,
+    /** SingleStage with the update added to the base by compensated (Kahan) summation. */
+    CompensatedSingleStage
+};
+
+/**
+ * @brief Arguments of a stage. All the state buffers are structure-of-arrays,
+ * i.e. x[0..n), y[n..2n) and z[2n..3n), where n is the stride (the allocated number of elements,
+ * which can be larger than the number of elements being integrated).
+ * If elementParameters is not NULL each element has its own sigma[0..n), rho[n..2n) and beta[2n..3n)
+ * (e.g. the points of a parameter sweep) and the parameters member is ignored.
+ * The compensated stage kinds carry the rounding error of each state update over to the next one in
+ * compensation (same layout as the state, zero initially), which recovers most of the accuracy lost by
+ * storing the state in float32.
+ */
+template<typename T>
+struct StageArguments {
+    Parameters<T> parameters;
+    const T *elementParameters;
+    CouplingView coupling;
+    const T *input;
+    T *base;
+    T *output;
+    T *accumulator;
+    T *compensation;
+    uint32 stride;
+    T timeStep;
+    T advance;
+    T weight;
+};
+
+/**
+ * @brief Computes the Lorenz derivative of a single element.
+ */
+template<typename T>
+inline void Derivative(const Parameters<T> &p, const T x, const T y, const T z, T &dx, T &dy, T &dz) {
+    dx = p.sigma * (y - x);
+    dy = (x * (p.rho - z)) - y;
+    dz = (x * y) - (p.beta * z);
+}
+
+/**
+ * @brief Computes the diffusive coupling term of element \a i from the x component of \a inputX.
+ */
+template<typename T>
+inline T CouplingTerm(const CouplingView &coupling, const T * const inputX, const uint32 i) {
+    float64 sum = 0.0;
+    const uint32 last = coupling.rowStart[i + 1u];
+    for (uint32 p = coupling.rowStart[i]; p < last; p++) {
+        sum += coupling.weights[p] * static_cast<float64>(inputX[coupling.columns[p]]);
+    }
+    return static_cast<T>(coupling.strength * (sum - (coupling.degree[i] * static_cast<float64>(inputX[i]))));
+}
+
+/**
+ * @brief Returns base + increment, adding the rounding error of the previous sum (Kahan summation).
+ * @details The rounding error of this sum is stored in \a compensation.
+ */
+template<typename T>
+inline T CompensatedSum(const T base, const T increment, T &compensation) {
+    const T corrected = increment - compensation;
+    const T sum = base + corrected;
+    compensation = (sum - base) - corrected;
+    return sum;
+}
+
+/**
+ * @brief Evaluates one Runge-Kutta stage on the elements [begin, end).
+ * @details The derivative of the stage (including the coupling, which is fused in the same loop)
+ * is folded straight into the accumulator and into the input of the next stage, so that each stage
+ * is a single pass over the state. The last stage writes the new state into the output and leaves
+ * the base untouched, so that the state at the beginning of the step remains available.
+ * The kind, the coupling and the per-element parameters are template parameters so that the uncoupled
+ * loop is branch free and can be vectorised by the compiler.
+ * @pre the output is neither the input nor the base, and the accumulator and the compensation do not overlap
+ * any other buffer. The compensation may be NULL if \a kind is not compensated.
+ */
+template<typename T, StageKind kind, bool coupled, bool varying>
+inline void StageRange(const StageArguments<T> &args, const uint32 begin, const uint32 end) {
+    const uint32 n = args.stride;
+    const T * const inX = args.input;
+    const T * const inY = &inX[n];
+    const T * const inZ = &inX[2u * n];
+    T * const baseX = args.base;
+    T * const baseY = &baseX[n];
+    T * const baseZ = &baseX[2u * n];
+    T * const outX = args.output;
+    T * const outY = &outX[n];
+    T * const outZ = &outX[2u * n];
+    T * const accX = args.accumulator;
+    T * const accY = &accX[n];
+    T * const accZ = &accX[2u * n];
+    // The compensation is NULL unless the kind is compensated: only offset it then
+    const bool compensatedKind = ((kind == CompensatedFinalStage) || (kind == CompensatedSingleStage));
+    T * const compX = args.compensation;
+    T * const compY = (compensatedKind) ? (&compX[n]) : (compX);
+    T * const compZ = (compensatedKind) ? (&compX[2u * n]) : (compX);
+    const T h = args.timeStep;
+    const T a = args.advance * h;
+    const T b = args.weight;
+    Parameters<T> p = args.parameters;
+    // The buffers do not overlap (see @pre): otherwise the compiler needs more run-time alias checks than it accepts and does not vectorise
+#pragma GCC ivdep
+    for (uint32 i = begin; i < end; i++) {
+        if (varying) {
+            p.sigma = args.elementParameters[i];
+            p.rho = args.elementParameters[n + i];
+            p.beta = args.elementParameters[(2u * n) + i];
+        }
+        T kx;
+        T ky;
+        T kz;
+        Derivative(p, inX[i], inY[i], inZ[i], kx, ky, kz);
+        if (coupled) {
+            kx += CouplingTerm(args.coupling, inX, i);
+        }
+        if (kind == FirstStage) {
+            accX[i] = b * kx;
+            accY[i] = b * ky;
+            accZ[i] = b * kz;
+            outX[i] = baseX[i] + (a * kx);
+            outY[i] = baseY[i] + (a * ky);
+            outZ[i] = baseZ[i] + (a * kz);
+        }
+        else if (kind == IntermediateStage) {
+            accX[i] += b * kx;
+            accY[i] += b * ky;
+            accZ[i] += b * kz;
+            outX[i] = baseX[i] + (a * kx);
+            outY[i] = baseY[i] + (a * ky);
+            outZ[i] = baseZ[i] + (a * kz);
+        }
+        else if (kind == FinalStage) {
+            outX[i] = baseX[i] + (h * (accX[i] + (b * kx)));
+            outY[i] = baseY[i] + (h * (accY[i] + (b * ky)));
+            outZ[i] = baseZ[i] + (h * (accZ[i] + (b * kz)));
+        }
+        else if (kind == SingleStage) {
+            outX[i] = baseX[i] + (h * b * kx);
+            outY[i] = baseY[i] + (h * b * ky);
+            outZ[i] = baseZ[i] + (h * b * kz);
+        }
+        else if (kind == CompensatedFinalStage) {
+            outX[i] = CompensatedSum(baseX[i], h * (accX[i] + (b * kx)), compX[i]);
+            outY[i] = CompensatedSum(baseY[i], h * (accY[i] + (b * ky)), compY[i]);
+            outZ[i] = CompensatedSum(baseZ[i], h * (accZ[i] + (b * kz)), compZ[i]);
+        }
+        else {
+            outX[i] = CompensatedSum(baseX[i], h * b * kx, compX[i]);
+            outY[i] = CompensatedSum(baseY[i], h * b * ky, compY[i]);
+            outZ[i] = CompensatedSum(baseZ[i], h * b * kz, compZ[i]);
+        }
+    }
+}
+
+/**
+ * @brief Dispatches StageRange on the run-time stage kind.
+ */
+template<typename T, bool coupled, bool varying>
+inline void StageKinds(const StageArguments<T> &args, const StageKind kind, const uint32 begin, const uint32 end) {
+    if (kind == FirstStage) {
+        StageRange<T, FirstStage, coupled, varying>(args, begin, end);
+    }
+    else if (kind == IntermediateStage) {
+        StageRange<T, IntermediateStage, coupled, varying>(args, begin, end);
+    }
+    else if (kind == FinalStage) {
+        StageRange<T, FinalStage, coupled, varying>(args, begin, end);
+    }
+    else if (kind == SingleStage) {
+        StageRange<T, SingleStage, coupled, varying>(args, begin, end);
+    }
+    else if (kind == CompensatedFinalStage) {
+        StageRange<T, CompensatedFinalStage, coupled, varying>(args, begin, end);
+    }
+    else {
+        StageRange<T, CompensatedSingleStage, coupled, varying>(args, begin, end);
+    }
+}
+
+/**
+ * @brief Dispatches StageRange on the run-time stage kind, coupling and per-element parameters.
+ * @pre the elements do not have their own parameters if coupled.
+ */
+template<typename T>
+inline void Stage(const StageArguments<T> &args, const StageKind kind, const uint32 begin, const uint32 end) {
+    if (args.coupling.rowStart != NULL_PTR(const uint32 *)) {
+        StageKinds<T, true, false>(args, kind, begin, end);
+    }
+    else if (args.elementParameters != NULL_PTR(const T *)) {
+        StageKinds<T, false, true>(args, kind, begin, end);
+    }
+    else {
+        StageKinds<T, false, false>(args, kind, begin, end);
+    }
+}
+
+/**
+ * @brief Computes the derivative of element \a i of the structure-of-arrays \a input (with stride \a n), including the coupling (if any).
+ */
+template<typename T>
+inline void ElementDerivative(const Parameters<T> &p, const CouplingView &coupling, const T * const input, const uint32 n, const uint32 i, T &dx,
+                              T &dy, T &dz) {
+    Derivative(p, input[i], input[n + i], input[(2u * n) + i], dx, dy, dz);
+    if (coupling.rowStart != NULL_PTR(const uint32 *)) {
+        dx += CouplingTerm(coupling, input, i);
+    }
+}
+
+/**
+ * @brief Product of the Jacobian of the Lorenz system at (x, y, z) with the tangent vector (vx, vy, vz).
+ */
+template<typename T>
+inline void JacobianProduct(const Parameters<T> &p, const T x, const T y, const T z, const T vx, const T vy, const T vz, T &dvx, T &dvy,
+                            T &dvz) {
+    dvx = p.sigma * (vy - vx);
+    dvy = (((p.rho - z) * vx) - vy) - (x * vz);
+    dvz = ((y * vx) + (x * vy)) - (p.beta * vz);
+}
+
+/**
+ * @brief Advances the tangent (linearised) dynamics of the elements [begin, end) over one step.
+ * @details Classical RK4 on the variational equation, with the Jacobian evaluated at the states \a s0 and \a s1
+ * at both ends of the step and at their average for the two midpoint stages (an O(h^2) approximation of the
+ * trajectory that does not bias the exponent estimate). All the stages are computed in registers, so that the cost
+ * is a single pass over the data whatever the integrator. The elements are not coupled (the per-element
+ * renormalisation would be meaningless for a network). \a elementParameters has the same meaning as in StageArguments.
+ */
+template<typename T, bool varying>
+inline void TangentRange(const Parameters<T> &parameters, const T * const elementParameters, const T * const s0, const T * const s1,
+                         const T * const tangent, T * const output, const uint32 n, const T h, const uint32 begin, const uint32 end) {
+    const T * const vx = tangent;
+    const T * const vy = &tangent[n];
+    const T * const vz = &tangent[2u * n];
+    T * const outX = output;
+    T * const outY = &output[n];
+    T * const outZ = &output[2u * n];
+    const T halfStep = h * static_cast<T>(0.5);
+    const T sixthStep = h / static_cast<T>(6.0);
+    Parameters<T> p = parameters;
+    for (uint32 i = begin; i < end; i++) {
+        if (varying) {
+            p.sigma = elementParameters[i];
+            p.rho = elementParameters[n + i];
+            p.beta = elementParameters[(2u * n) + i];
+        }
+        const T x0 = s0[i];
+        const T y0 = s0[n + i];
+        const T z0 = s0[(2u * n) + i];
+        const T x1 = s1[i];
+        const T y1 = s1[n + i];
+        const T z1 = s1[(2u * n) + i];
+        const T xm = static_cast<T>(0.5) * (x0 + x1);
+        const T ym = static_cast<T>(0.5) * (y0 + y1);
+        const T zm = static_cast<T>(0.5) * (z0 + z1);
+        T k1x;
+        T k1y;
+        T k1z;
+        T k2x;
+        T k2y;
+        T k2z;
+        T k3x;
+        T k3y;
+        T k3z;
+        T k4x;
+        T k4y;
+        T k4z;
+        JacobianProduct(p, x0, y0, z0, vx[i], vy[i], vz[i], k1x, k1y, k1z);
+        JacobianProduct(p, xm, ym, zm, vx[i] + (halfStep * k1x), vy[i] + (halfStep * k1y), vz[i] + (halfStep * k1z), k2x, k2y, k2z);
+        JacobianProduct(p, xm, ym, zm, vx[i] + (halfStep * k2x), vy[i] + (halfStep * k2y), vz[i] + (halfStep * k2z), k3x, k3y, k3z);
+        JacobianProduct(p, x1, y1, z1, vx[i] + (h * k3x), vy[i] + (h * k3y), vz[i] + (h * k3z), k4x, k4y, k4z);
+        outX[i] = vx[i] + (sixthStep * (((k1x + (static_cast<T>(2.0) * k2x)) + (static_cast<T>(2.0) * k3x)) + k4x));
+        outY[i] = vy[i] + (sixthStep * (((k1y + (static_cast<T>(2.0) * k2y)) + (static_cast<T>(2.0) * k3y)) + k4y));
+        outZ[i] = vz[i] + (sixthStep * (((k1z + (static_cast<T>(2.0) * k2z)) + (static_cast<T>(2.0) * k3z)) + k4z));
+    }
+}
+
+/**
+ * @brief Dispatches TangentRange on the per-element parameters.
+ */
+template<typename T>
+inline void Tangent(const Parameters<T> &p, const T * const elementParameters, const T * const s0, const T * const s1, const T * const tangent,
+                    T * const output, const uint32 n, const T h, const uint32 begin, const uint32 end) {
+    if (elementParameters != NULL_PTR(const T *)) {
+        TangentRange<T, true>(p, elementParameters, s0, s1, tangent, output, n, h, begin, end);
+    }
+    else {
+        TangentRange<T, false>(p, elementParameters, s0, s1, tangent, output, n, h, begin, end);
+    }
+}
+
+/**
+ * @brief Locates the crossing of the plane normal . s = offset inside a step using the cubic Hermite dense output.
+ * @details The state along the step is interpolated with the cubic Hermite polynomial defined by the states
+ * (s0, s1) and the derivatives (f0, f1) at both ends of the step. As the event function is linear in the state
+ * it reduces to a scalar cubic in the normalised time theta, whose root is bracketed by bisection (the number of
+ * iterations is fixed, so the cost of refining an event is bounded).
+ * @param[in] g0 normal . s0 - offset.
+ * @param[in] gf0 h * (normal . f0).
+ * @param[in] g1 normal . s1 - offset.
+ * @param[in] gf1 h * (normal . f1).
+ * @return theta in [0, 1].
+ * @pre g0 and g1 have different signs (or g1 is zero).
+ */
+inline float64 LocateCrossing(const float64 g0, const float64 gf0, const float64 g1, const float64 gf1) {
+    float64 low = 0.0;
+    float64 high = 1.0;
+    const bool rising = (g0 < 0.0);
+    uint32 iteration;
+    for (iteration = 0u; iteration < 32u; iteration++) {
+        const float64 theta = 0.5 * (low + high);
+        const float64 theta2 = theta * theta;
+        const float64 theta3 = theta2 * theta;
+        const float64 h00 = ((2.0 * theta3) - (3.0 * theta2)) + 1.0;
+        const float64 h10 = (theta3 - (2.0 * theta2)) + theta;
+        const float64 h01 = (3.0 * theta2) - (2.0 * theta3);
+        const float64 h11 = theta3 - theta2;
+        const float64 g = (h00 * g0) + (h10 * gf0) + (h01 * g1) + (h11 * gf1);
+        if ((g < 0.0) == rising) {
+            low = theta;
+        }
+        else {
+            high = theta;
+        }
+    }
+    return 0.5 * (low + high);
+}
+
+/**
+ * @brief Returns the kind of the stage \a stage of a method with \a numberOfStages stages.
+ * @param[in] compensated if true the stage which writes the new state is a compensated kind.
+ */
+inline StageKind GetStageKind(const uint32 stage, const uint32 numberOfStages, const bool compensated = false) {
+    StageKind kind = IntermediateStage;
+    if (numberOfStages == 1u) {
+        kind = SingleStage;
+    }
+    else if (stage == 0u) {
+        kind = FirstStage;
+    }
+    else if ((stage + 1u) == numberOfStages) {
+        kind = FinalStage;
+    }
+    else {
+        kind = IntermediateStage;
+    }
+    if (compensated) {
+        if (kind == SingleStage) {
+            kind = CompensatedSingleStage;
+        }
+        else if (kind == FinalStage) {
+            kind = CompensatedFinalStage;
+        }
+        else {
+            // The other stages do not write the state
+        }
+    }
+    return kind;
+}
+
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LORENZKERNELS_H_ */
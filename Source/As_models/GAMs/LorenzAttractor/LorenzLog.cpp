@@ -0,0 +1,283 @@
+/**
+ * @file LorenzLog.cpp
+ * @brief Source file for class LorenzLog
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This source file contains the definition of all the methods for
+ * the class LorenzLog (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
+#include "MemoryOperationsHelper.h"
+#include "Sleep.h"
+#include "LorenzLog.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * Number of attempts of a producer to take the spinlock before dropping its record.
+ */
+const MARTe::uint32 MaximumAttempts = 1000u;
+
+/**
+ * 32-bit FNV-1a parameters.
+ */
+const MARTe::uint32 FnvOffsetBasis = 2166136261u;
+const MARTe::uint32 FnvPrime = 16777619u;
+
+/**
+ * Largest queue capacity.
+ */
+const MARTe::uint32 MaximumCapacity = 0x100000u;
+
+/**
+ * Period of the drain thread in milliseconds.
+ */
+const MARTe::int32 DrainPeriod = 20;
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LorenzLog::LorenzLog() {
+    verbosity = 0u;
+    records = NULL_PTR(Record *);
+    capacity = 0u;
+    tail = 0;
+    head = 0;
+    producerFlag = 0;
+    repeats = 0u;
+    rateLimited = 0;
+    dropped = 0;
+    last.code = 0u;
+    last.index = 0u;
+    last.numberOfElements = 0u;
+    last.level = 0u;
+    last.value = 0u;
+    last.hash = 0u;
+    last.previousRepeats = 0u;
+    hasLast = false;
+    tokens = 0u;
+    maximumTokens = 0u;
+    ticksPerRecord = 0u;
+    lastRefill = 0u;
+    formatter = NULL_PTR(FormatterFunction);
+    context = NULL_PTR(void *);
+    alive = 0;
+    quit = 0;
+}
+
+LorenzLog::~LorenzLog() {
+    Stop();
+}
+
+bool LorenzLog::Start(const uint32 verbosityIn, const uint32 rateIn, const uint32 burstIn, const uint32 capacityIn, const uint32 cpuMask,
+                      const FormatterFunction formatterIn, void * const contextIn) {
+    Stop();
+    bool ok = ((rateIn > 0u) && (burstIn > 0u) && (capacityIn > 0u) && (capacityIn <= MaximumCapacity));
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The log Rate, Burst and Capacity shall be > 0 (and Capacity <= %u)", MaximumCapacity);
+    }
+    if (ok) {
+        capacity = 1u;
+        while (capacity < capacityIn) {
+            capacity <<= 1u;
+        }
+        records = new Record[capacity];
+        tail = 0;
+        head = 0;
+        producerFlag = 0;
+        repeats = 0u;
+        rateLimited = 0;
+        dropped = 0;
+        hasLast = false;
+        ticksPerRecord = HighResolutionTimer::Frequency() / static_cast<uint64>(rateIn);
+        maximumTokens = ticksPerRecord * static_cast<uint64>(burstIn);
+        tokens = maximumTokens;
+        lastRefill = HighResolutionTimer::Counter();
+        formatter = formatterIn;
+        context = contextIn;
+        // Add() only keeps records once the queue is ready
+        verbosity = verbosityIn;
+        ProcessorType cpus = UndefinedCPUs;
+        if (cpuMask != 0u) {
+            cpus = ProcessorType(cpuMask);
+        }
+        Atomic::Increment(&alive);
+        ThreadIdentifier tid = Threads::BeginThread(&DrainLoop, this, THREADS_DEFAULT_STACKSIZE, "LorenzLog", ExceptionHandler::NotHandled, cpus);
+        ok = (tid != InvalidThreadIdentifier);
+        if (!ok) {
+            Atomic::Decrement(&alive);
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to launch the log thread");
+        }
+    }
+    return ok;
+}
+
+void LorenzLog::Stop() {
+    // Add() discards everything until the next Start()
+    verbosity = 0u;
+    quit = 1;
+    while (alive > 0) {
+        Sleep::MSec(1);
+    }
+    quit = 0;
+    // A producer which passed IsEnabled() before verbosity was cleared stores its record while holding the spinlock
+    while (!Atomic::TestAndSet(&producerFlag)) {
+    }
+    delete[] records;
+    records = NULL_PTR(Record *);
+    (void) Atomic::Exchange(&producerFlag, 0);
+}
+
+bool LorenzLog::IsEnabled(const Level level) const {
+    return (static_cast<uint32>(level) <= verbosity);
+}
+
+void LorenzLog::Add(const Level level, const uint32 code, const uint32 index, const uint32 numberOfElements, const void * const valueAddress,
+                    const uint32 valueSize) {
+    if (IsEnabled(level)) {
+        Record record;
+        record.code = code;
+        record.index = index;
+        record.numberOfElements = numberOfElements;
+        record.level = static_cast<uint32>(level);
+        record.value = 0u;
+        record.hash = FnvOffsetBasis;
+        record.previousRepeats = 0u;
+        if (valueAddress != NULL_PTR(const void *)) {
+            (void) MemoryOperationsHelper::Copy(&record.value, valueAddress, (valueSize < 8u) ? (valueSize) : (8u));
+            // Beyond the first element (e.g. of an array) but with a bounded cost
+            const uint8 * const bytes = static_cast<const uint8 *>(valueAddress);
+            const uint32 hashedSize = (valueSize < HashedValueSize) ? (valueSize) : (HashedValueSize);
+            uint32 b;
+            for (b = 0u; b < hashedSize; b++) {
+                record.hash = (record.hash ^ static_cast<uint32>(bytes[b])) * FnvPrime;
+            }
+        }
+        bool acquired = false;
+        uint32 attempt;
+        for (attempt = 0u; (attempt < MaximumAttempts) && (!acquired); attempt++) {
+            acquired = Atomic::TestAndSet(&producerFlag);
+        }
+        if ((acquired) && (records == NULL_PTR(Record *))) {
+            // Stopped since IsEnabled()
+            (void) Atomic::Exchange(&producerFlag, 0);
+        }
+        else if (acquired) {
+            const bool repeated = ((hasLast) && (last.code == record.code) && (last.index == record.index) && (last.level == record.level)
+                    && (last.numberOfElements == record.numberOfElements) && (last.value == record.value) && (last.hash == record.hash));
+            if (repeated) {
+                repeats++;
+            }
+            else {
+                const uint64 now = HighResolutionTimer::Counter();
+                tokens += (now - lastRefill);
+                lastRefill = now;
+                if (tokens > maximumTokens) {
+                    tokens = maximumTokens;
+                }
+                if (tokens < ticksPerRecord) {
+                    Atomic::Increment(&rateLimited);
+                }
+                else if (static_cast<uint32>(tail - head) >= capacity) {
+                    Atomic::Increment(&dropped);
+                }
+                else {
+                    tokens -= ticksPerRecord;
+                    record.previousRepeats = repeats;
+                    repeats = 0u;
+                    records[static_cast<uint32>(tail) & (capacity - 1u)] = record;
+                    // The atomic (locked) increment publishes the record to the drain thread
+                    Atomic::Increment(&tail);
+                    last = record;
+                    hasLast = true;
+                }
+            }
+            (void) Atomic::Exchange(&producerFlag, 0);
+        }
+        else {
+            Atomic::Increment(&dropped);
+        }
+    }
+}
+
+void LorenzLog::Drain() {
+    const int32 end = tail;
+    while (head != end) {
+        const Record &record = records[static_cast<uint32>(head) & (capacity - 1u)];
+        if (record.previousRepeats > 0u) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Last record repeated %u times", record.previousRepeats);
+        }
+        formatter(context, record);
+        Atomic::Increment(&head);
+    }
+    // The repetitions of the last record are only reported once it was formatted, i.e. if no record was added since
+    uint32 pendingRepeats = 0u;
+    if (Atomic::TestAndSet(&producerFlag)) {
+        if (tail == end) {
+            pendingRepeats = repeats;
+            repeats = 0u;
+        }
+        (void) Atomic::Exchange(&producerFlag, 0);
+    }
+    if (pendingRepeats > 0u) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Last record repeated %u times", pendingRepeats);
+    }
+    const int32 limited = Atomic::Exchange(&rateLimited, 0);
+    if (limited > 0) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "%d log records suppressed by the rate limit", limited);
+    }
+    const int32 lost = Atomic::Exchange(&dropped, 0);
+    if (lost > 0) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "%d log records dropped (queue full or busy)", lost);
+    }
+}
+
+void LorenzLog::DrainLoop(const void * const arguments) {
+    LorenzLog *log = const_cast<LorenzLog *>(static_cast<const LorenzLog *>(arguments));
+    while (log->quit == 0) {
+        log->Drain();
+        Sleep::MSec(DrainPeriod);
+    }
+    log->Drain();
+    Atomic::Decrement(&log->alive);
+}
+
+}
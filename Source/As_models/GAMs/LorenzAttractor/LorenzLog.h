@@ -0,0 +1,292 @@
+/**
+ * @file LorenzLog.h
+ * @brief Header file for class LorenzLog
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This header file contains the declaration of the class
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+
+#ifndef LORENZLOG_H_
+#define LORENZLOG_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "ProcessorType.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Asynchronous diagnostics log: the callers only store a few binary fields in a bounded queue which
+ * is drained, and formatted, by a background thread.
+ * @details Add() never allocates, formats or blocks:
+ *  - records above the configured verbosity are discarded before anything else is done;
+ *  - a record identical (same code, index, number of elements and first HashedValueSize bytes of the value,
+ *    compared through their hash) to the previous one only increments a repeat counter, reported by the drain
+ *    thread as "last record repeated N times". The cost of Add() is thus bounded whatever the size of the value;
+ *  - a token bucket limits the rate of the records (Rate per second, with bursts of Burst records);
+ *    the records refused by the rate limit or because the queue is full are counted and reported.
+ *
+ * The queue is not lock-free. The producers are serialised by a spinlock (Atomic::TestAndSet) held while the
+ * record is compared, rate limited and copied to its slot. A producer which cannot take it within a bounded
+ * number of tries does not wait any longer: its record is dropped (and counted as such), so that records may be
+ * lost under contention. The consumer side is a single-producer/single-consumer ring whose indices are
+ * published with atomic operations; the drain thread only tries to take the spinlock, when the queue is empty,
+ * to report the pending repetitions.
+ *
+ * The records are formatted by the FormatterFunction given to Start(), from the drain thread.
+ */
+class LorenzLog {
+public:
+
+    /**
+     * @brief Importance of a record. A record is kept if its level is <= the verbosity.
+     */
+    enum Level {
+        /** A request was rejected. */
+        ErrorLevel = 1,
+        /** Normal operation. */
+        InformationLevel = 2
+    };
+
+    /**
+     * @brief A log record. The meaning of code, index and value is defined by the producer.
+     */
+    struct Record {
+        /** Identifies the message. */
+        uint32 code;
+        /** E.g. a signal index. */
+        uint32 index;
+        /** E.g. the number of elements of the signal. */
+        uint32 numberOfElements;
+        /** A Level. */
+        uint32 level;
+        /** Raw bits of the first element of the value (at most 8 bytes). */
+        uint64 value;
+        /** FNV-1a hash of the first HashedValueSize bytes of the value. */
+        uint32 hash;
+        /** Number of repetitions of the previous record not yet reported (set by Add()). */
+        uint32 previousRepeats;
+    };
+
+    /**
+     * @brief Formats and reports \a record (called by the drain thread).
+     */
+    typedef void (*FormatterFunction)(void * const context, const Record &record);
+
+    /**
+     * Default verbosity (all the records).
+     */
+    static const uint32 DefaultVerbosity = 2u;
+
+    /**
+     * Default number of records per second.
+     */
+    static const uint32 DefaultRate = 100u;
+
+    /**
+     * Default burst.
+     */
+    static const uint32 DefaultBurst = 50u;
+
+    /**
+     * Default queue capacity.
+     */
+    static const uint32 DefaultCapacity = 256u;
+
+    /**
+     * Number of bytes of a value which take part in the detection of the repetitions.
+     */
+    static const uint32 HashedValueSize = 64u;
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LorenzLog();
+
+    /**
+     * @brief Destructor. Calls Stop().
+     */
+    ~LorenzLog();
+
+    /**
+     * @brief Allocates the queue and launches the drain thread.
+     * @param[in] verbosityIn the highest Level kept (0 discards everything).
+     * @param[in] rateIn the maximum sustained number of records per second.
+     * @param[in] burstIn the maximum number of records accepted at once.
+     * @param[in] capacityIn the queue capacity (rounded up to a power of two).
+     * @param[in] cpuMask if not zero, the CPUs of the drain thread.
+     * @param[in] formatterIn called by the drain thread for each record.
+     * @param[in] contextIn passed to \a formatterIn.
+     * @return true if the thread could be launched.
+     * @pre rateIn > 0 && burstIn > 0 && capacityIn > 0.
+     */
+    bool Start(const uint32 verbosityIn, const uint32 rateIn, const uint32 burstIn, const uint32 capacityIn, const uint32 cpuMask,
+               const FormatterFunction formatterIn, void * const contextIn);
+
+    /**
+     * @brief Drains the queue, joins the drain thread and frees the queue.
+     * @details Add() discards the records from the beginning of Stop(): a concurrent Add() either completes before
+     * the queue is freed (the spinlock is taken to free it) or finds it freed.
+     */
+    void Stop();
+
+    /**
+     * @brief Adds a record (see the class description). May be called by any thread once Start() returned.
+     * @param[in] valueAddress if not NULL, the value of \a valueSize bytes: its first 8 bytes (at most) are copied
+     * to the record and its first HashedValueSize bytes (at most) are hashed.
+     */
+    void Add(const Level level, const uint32 code, const uint32 index, const uint32 numberOfElements, const void * const valueAddress,
+             const uint32 valueSize);
+
+    /**
+     * @brief Returns true if a record of this level would be kept, i.e. if it is worth preparing its fields.
+     */
+    bool IsEnabled(const Level level) const;
+
+private:
+
+    /**
+     * @brief Drain thread body.
+     */
+    static void DrainLoop(const void * const arguments);
+
+    /**
+     * @brief Formats the queued records and the counters.
+     */
+    void Drain();
+
+    /**
+     * Highest Level kept (cleared first by Stop()).
+     */
+    volatile uint32 verbosity;
+
+    /**
+     * The ring (capacity records).
+     */
+    Record *records;
+
+    /**
+     * Power of two.
+     */
+    uint32 capacity;
+
+    /**
+     * Number of records added (written by the producer holding the spinlock).
+     */
+    volatile int32 tail;
+
+    /**
+     * Number of records formatted (written by the drain thread).
+     */
+    volatile int32 head;
+
+    /**
+     * Spinlock of the producers, held while a record is compared, rate limited and stored.
+     */
+    volatile int32 producerFlag;
+
+    /**
+     * Number of repetitions of the last record not yet reported (only accessed while holding the spinlock).
+     */
+    uint32 repeats;
+
+    /**
+     * Records refused because of the rate limit.
+     */
+    volatile int32 rateLimited;
+
+    /**
+     * Records refused because the queue was full or the spinlock was busy.
+     */
+    volatile int32 dropped;
+
+    /**
+     * The last record added (only accessed by the producer holding the spinlock).
+     */
+    Record last;
+
+    /**
+     * True if last is valid.
+     */
+    bool hasLast;
+
+    /**
+     * Available tokens, in ticks of HighResolutionTimer (one record costs ticksPerRecord).
+     */
+    uint64 tokens;
+
+    /**
+     * Tokens of a full bucket.
+     */
+    uint64 maximumTokens;
+
+    /**
+     * HighResolutionTimer ticks per record.
+     */
+    uint64 ticksPerRecord;
+
+    /**
+     * Counter at the last refill.
+     */
+    uint64 lastRefill;
+
+    /**
+     * Formats the records.
+     */
+    FormatterFunction formatter;
+
+    /**
+     * Context of the formatter.
+     */
+    void *context;
+
+    /**
+     * Set while the drain thread runs.
+     */
+    volatile int32 alive;
+
+    /**
+     * Set to request the drain thread to terminate.
+     */
+    volatile int32 quit;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LORENZLOG_H_ */
@@ -0,0 +1,305 @@
+/**
+ * @file LorenzNetwork.cpp
+ * @brief Source file for class LorenzNetwork
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This source file contains the definition of all the methods for
+ * the class LorenzNetwork (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "LorenzNetwork.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LorenzNetwork::LorenzNetwork() {
+    numberOfNodes = 0u;
+    numberOfEdges = 0u;
+    rowStart = NULL_PTR(uint32 *);
+    columnIndex = NULL_PTR(uint32 *);
+    weights = NULL_PTR(float64 *);
+    degree = NULL_PTR(float64 *);
+    permutation = NULL_PTR(uint32 *);
+    inversePermutation = NULL_PTR(uint32 *);
+}
+
+LorenzNetwork::~LorenzNetwork() {
+    Clean();
+}
+
+void LorenzNetwork::Clean() {
+    delete[] rowStart;
+    delete[] columnIndex;
+    delete[] weights;
+    delete[] degree;
+    delete[] permutation;
+    delete[] inversePermutation;
+    rowStart = NULL_PTR(uint32 *);
+    columnIndex = NULL_PTR(uint32 *);
+    weights = NULL_PTR(float64 *);
+    degree = NULL_PTR(float64 *);
+    permutation = NULL_PTR(uint32 *);
+    inversePermutation = NULL_PTR(uint32 *);
+    numberOfNodes = 0u;
+    numberOfEdges = 0u;
+}
+
+bool LorenzNetwork::Build(const uint32 numberOfNodesIn, const uint32 numberOfEdgesIn, const uint32 * const rows, const uint32 * const columns,
+                          const float64 * const weightsIn, const bool reorder) {
+    Clean();
+    bool ok = (numberOfNodesIn > 0u);
+    uint32 e;
+    for (e = 0u; (e < numberOfEdgesIn) && (ok); e++) {
+        ok = ((rows[e] < numberOfNodesIn) && (columns[e] < numberOfNodesIn));
+    }
+    if (ok) {
+        numberOfNodes = numberOfNodesIn;
+        numberOfEdges = numberOfEdgesIn;
+        rowStart = new uint32[numberOfNodes + 1u];
+        columnIndex = new uint32[numberOfEdges + 1u];
+        weights = new float64[numberOfEdges + 1u];
+        degree = new float64[numberOfNodes];
+        permutation = new uint32[numberOfNodes];
+        inversePermutation = new uint32[numberOfNodes];
+
+        uint32 i;
+        if (reorder) {
+            ReverseCuthillMcKee(rows, columns);
+        }
+        else {
+            for (i = 0u; i < numberOfNodes; i++) {
+                permutation[i] = i;
+            }
+        }
+        for (i = 0u; i < numberOfNodes; i++) {
+            inversePermutation[permutation[i]] = i;
+        }
+
+        // Two stable counting sorts (by column, then by row) give the CSR with sorted columns
+        uint32 *count = new uint32[numberOfNodes + 1u];
+        uint32 *byColumn = new uint32[numberOfEdges + 1u];
+        for (i = 0u; i <= numberOfNodes; i++) {
+            count[i] = 0u;
+        }
+        for (e = 0u; e < numberOfEdges; e++) {
+            count[inversePermutation[columns[e]] + 1u]++;
+        }
+        for (i = 0u; i < numberOfNodes; i++) {
+            count[i + 1u] += count[i];
+        }
+        for (e = 0u; e < numberOfEdges; e++) {
+            uint32 c = inversePermutation[columns[e]];
+            byColumn[count[c]] = e;
+            count[c]++;
+        }
+        for (i = 0u; i <= numberOfNodes; i++) {
+            rowStart[i] = 0u;
+        }
+        for (e = 0u; e < numberOfEdges; e++) {
+            rowStart[inversePermutation[rows[e]] + 1u]++;
+        }
+        for (i = 0u; i < numberOfNodes; i++) {
+            rowStart[i + 1u] += rowStart[i];
+        }
+        for (i = 0u; i < numberOfNodes; i++) {
+            count[i] = rowStart[i];
+        }
+        for (e = 0u; e < numberOfEdges; e++) {
+            uint32 edge = byColumn[e];
+            uint32 r = inversePermutation[rows[edge]];
+            uint32 p = count[r];
+            count[r]++;
+            columnIndex[p] = inversePermutation[columns[edge]];
+            weights[p] = (weightsIn != NULL_PTR(const float64 *)) ? (weightsIn[edge]) : (1.0);
+        }
+        delete[] count;
+        delete[] byColumn;
+
+        for (i = 0u; i < numberOfNodes; i++) {
+            degree[i] = 0.0;
+            uint32 p;
+            for (p = rowStart[i]; p < rowStart[i + 1u]; p++) {
+                degree[i] += weights[p];
+            }
+        }
+    }
+    return ok;
+}
+
+void LorenzNetwork::ReverseCuthillMcKee(const uint32 * const rows, const uint32 * const columns) {
+    // Symmetric adjacency pattern (self loops do not contribute to the bandwidth)
+    uint32 *adjacencyStart = new uint32[numberOfNodes + 1u];
+    uint32 *adjacency = new uint32[(2u * numberOfEdges) + 1u];
+    uint32 *fill = new uint32[numberOfNodes];
+    uint32 i;
+    uint32 e;
+    for (i = 0u; i <= numberOfNodes; i++) {
+        adjacencyStart[i] = 0u;
+    }
+    for (e = 0u; e < numberOfEdges; e++) {
+        if (rows[e] != columns[e]) {
+            adjacencyStart[rows[e] + 1u]++;
+            adjacencyStart[columns[e] + 1u]++;
+        }
+    }
+    for (i = 0u; i < numberOfNodes; i++) {
+        adjacencyStart[i + 1u] += adjacencyStart[i];
+        fill[i] = adjacencyStart[i];
+    }
+    for (e = 0u; e < numberOfEdges; e++) {
+        if (rows[e] != columns[e]) {
+            adjacency[fill[rows[e]]] = columns[e];
+            fill[rows[e]]++;
+            adjacency[fill[columns[e]]] = rows[e];
+            fill[columns[e]]++;
+        }
+    }
+
+    // Nodes sorted by increasing degree, used to pick the start node of each connected component
+    uint32 maxDegree = 0u;
+    for (i = 0u; i < numberOfNodes; i++) {
+        uint32 d = adjacencyStart[i + 1u] - adjacencyStart[i];
+        if (d > maxDegree) {
+            maxDegree = d;
+        }
+    }
+    uint32 *degreeCount = new uint32[maxDegree + 2u];
+    uint32 *byDegree = new uint32[numberOfNodes];
+    for (i = 0u; i < (maxDegree + 2u); i++) {
+        degreeCount[i] = 0u;
+    }
+    for (i = 0u; i < numberOfNodes; i++) {
+        degreeCount[(adjacencyStart[i + 1u] - adjacencyStart[i]) + 1u]++;
+    }
+    for (i = 0u; i <= maxDegree; i++) {
+        degreeCount[i + 1u] += degreeCount[i];
+    }
+    for (i = 0u; i < numberOfNodes; i++) {
+        uint32 d = adjacencyStart[i + 1u] - adjacencyStart[i];
+        byDegree[degreeCount[d]] = i;
+        degreeCount[d]++;
+    }
+
+    // Breadth first search, visiting the neighbours by increasing degree. fill is reused as the visited flag.
+    uint32 *order = inversePermutation;
+    for (i = 0u; i < numberOfNodes; i++) {
+        fill[i] = 0u;
+    }
+    uint32 tail = 0u;
+    uint32 next;
+    for (next = 0u; next < numberOfNodes; next++) {
+        uint32 start = byDegree[next];
+        if (fill[start] == 0u) {
+            fill[start] = 1u;
+            uint32 head = tail;
+            order[tail] = start;
+            tail++;
+            while (head < tail) {
+                uint32 node = order[head];
+                head++;
+                uint32 first = tail;
+                uint32 p;
+                for (p = adjacencyStart[node]; p < adjacencyStart[node + 1u]; p++) {
+                    uint32 neighbour = adjacency[p];
+                    if (fill[neighbour] == 0u) {
+                        fill[neighbour] = 1u;
+                        uint32 d = adjacencyStart[neighbour + 1u] - adjacencyStart[neighbour];
+                        // Insertion sort of the newly discovered nodes by degree
+                        uint32 q = tail;
+                        while ((q > first) && ((adjacencyStart[order[q - 1u] + 1u] - adjacencyStart[order[q - 1u]]) > d)) {
+                            order[q] = order[q - 1u];
+                            q--;
+                        }
+                        order[q] = neighbour;
+                        tail++;
+                    }
+                }
+            }
+        }
+    }
+    for (i = 0u; i < numberOfNodes; i++) {
+        permutation[i] = order[(numberOfNodes - 1u) - i];
+    }
+
+    delete[] adjacencyStart;
+    delete[] adjacency;
+    delete[] fill;
+    delete[] degreeCount;
+    delete[] byDegree;
+}
+
+LorenzKernels::CouplingView LorenzNetwork::GetView(const float64 strength) const {
+    LorenzKernels::CouplingView view;
+    view.rowStart = rowStart;
+    view.columns = columnIndex;
+    view.weights = weights;
+    view.degree = degree;
+    view.strength = strength;
+    return view;
+}
+
+const uint32 *LorenzNetwork::GetPermutation() const {
+    return permutation;
+}
+
+const uint32 *LorenzNetwork::GetInversePermutation() const {
+    return inversePermutation;
+}
+
+uint32 LorenzNetwork::GetNumberOfNodes() const {
+    return numberOfNodes;
+}
+
+uint32 LorenzNetwork::GetNumberOfEdges() const {
+    return numberOfEdges;
+}
+
+uint32 LorenzNetwork::GetBandwidth() const {
+    uint32 bandwidth = 0u;
+    uint32 i;
+    for (i = 0u; i < numberOfNodes; i++) {
+        uint32 p;
+        for (p = rowStart[i]; p < rowStart[i + 1u]; p++) {
+            uint32 distance = (columnIndex[p] > i) ? (columnIndex[p] - i) : (i - columnIndex[p]);
+            if (distance > bandwidth) {
+                bandwidth = distance;
+            }
+        }
+    }
+    return bandwidth;
+}
+
+}
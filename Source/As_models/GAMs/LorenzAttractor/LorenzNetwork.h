@@ -0,0 +1,172 @@
+/**
+ * @file LorenzNetwork.h
+ * @brief Header file for class LorenzNetwork
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This header file contains the declaration of the class
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LORENZNETWORK_H_
+#define LORENZNETWORK_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "LorenzKernels.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Sparse coupling matrix of a network of Lorenz nodes.
+ * @details The matrix is provided as a list of (row, column, weight) edges and is stored in
+ * CSR format with the columns of each row sorted. The nodes can optionally be renumbered with
+ * the reverse Cuthill-McKee ordering of the (symmetrised) adjacency graph, which reduces the
+ * bandwidth of the matrix and thus keeps the neighbours of a node close in memory.
+ *
+ * All the memory is allocated by Build(); the accessors are meant to be used on the real-time path.
+ */
+class LorenzNetwork {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LorenzNetwork();
+
+    /**
+     * @brief Destructor. Frees the CSR arrays.
+     */
+    ~LorenzNetwork();
+
+    /**
+     * @brief Builds the CSR matrix (and the node permutation) from a list of edges.
+     * @param[in] numberOfNodesIn the number of nodes of the network.
+     * @param[in] numberOfEdgesIn the number of edges.
+     * @param[in] rows the row (destination node) of each edge.
+     * @param[in] columns the column (source node) of each edge.
+     * @param[in] weightsIn the weight of each edge. If NULL all the weights are 1.
+     * @param[in] reorder if true the nodes are renumbered with the reverse Cuthill-McKee ordering.
+     * @return true if all the node indices are < numberOfNodesIn.
+     */
+    bool Build(const uint32 numberOfNodesIn, const uint32 numberOfEdgesIn, const uint32 * const rows, const uint32 * const columns,
+               const float64 * const weightsIn, const bool reorder);
+
+    /**
+     * @brief Gets a kernel view of the matrix with the given coupling strength.
+     */
+    LorenzKernels::CouplingView GetView(const float64 strength) const;
+
+    /**
+     * @brief Gets the permutation from the internal node index to the configured node index.
+     */
+    const uint32 *GetPermutation() const;
+
+    /**
+     * @brief Gets the permutation from the configured node index to the internal node index.
+     */
+    const uint32 *GetInversePermutation() const;
+
+    /**
+     * @brief Gets the number of nodes.
+     */
+    uint32 GetNumberOfNodes() const;
+
+    /**
+     * @brief Gets the number of stored edges.
+     */
+    uint32 GetNumberOfEdges() const;
+
+    /**
+     * @brief Gets the bandwidth (max |i - j| over the stored entries) of the (possibly reordered) matrix.
+     */
+    uint32 GetBandwidth() const;
+
+private:
+
+    /**
+     * @brief Frees all the arrays.
+     */
+    void Clean();
+
+    /**
+     * @brief Computes the reverse Cuthill-McKee ordering of the symmetrised adjacency graph into permutation.
+     */
+    void ReverseCuthillMcKee(const uint32 * const rows, const uint32 * const columns);
+
+    /**
+     * Number of nodes.
+     */
+    uint32 numberOfNodes;
+
+    /**
+     * Number of edges.
+     */
+    uint32 numberOfEdges;
+
+    /**
+     * CSR row offsets (numberOfNodes + 1).
+     */
+    uint32 *rowStart;
+
+    /**
+     * CSR column indices (numberOfEdges).
+     */
+    uint32 *columnIndex;
+
+    /**
+     * CSR weights (numberOfEdges).
+     */
+    float64 *weights;
+
+    /**
+     * Sum of the weights of each row (numberOfNodes).
+     */
+    float64 *degree;
+
+    /**
+     * Internal index to configured index.
+     */
+    uint32 *permutation;
+
+    /**
+     * Configured index to internal index.
+     */
+    uint32 *inversePermutation;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LORENZNETWORK_H_ */
@@ -0,0 +1,159 @@
+/**
+ * @file LorenzRandom.h
+ * @brief Header file for class LorenzRandom
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This header file contains the declaration of the class
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LORENZRANDOM_H_
+#define LORENZRANDOM_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Small seeded pseudo-random generator (xorshift64*) used to sample initial conditions and ensembles.
+ * @details The sequence only depends on the seed, so that the sampled states are reproducible across runs
+ * and platforms. Gaussian samples are drawn in pairs with the Marsaglia polar method; the second sample
+ * of each pair is returned by the next call.
+ */
+class LorenzRandom {
+public:
+
+    /**
+     * @brief Constructor. Calls SetSeed(seed).
+     */
+    explicit LorenzRandom(const uint64 seed = 1u);
+
+    /**
+     * @brief Restarts the sequence. A zero seed is replaced by a fixed non-zero value.
+     */
+    void SetSeed(const uint64 seed);
+
+    /**
+     * @brief Gets the next 64 bit integer of the sequence.
+     */
+    uint64 Next();
+
+    /**
+     * @brief Gets a sample uniformly distributed in [0, 1).
+     */
+    float64 Uniform();
+
+    /**
+     * @brief Gets a sample of the standard normal distribution.
+     */
+    float64 Gaussian();
+
+private:
+
+    /**
+     * Generator state (never zero).
+     */
+    uint64 generatorState;
+
+    /**
+     * Second sample of the last Gaussian pair.
+     */
+    float64 spare;
+
+    /**
+     * True if spare holds a sample not yet returned.
+     */
+    bool hasSpare;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+inline LorenzRandom::LorenzRandom(const uint64 seed) {
+    generatorState = 1u;
+    spare = 0.0;
+    hasSpare = false;
+    SetSeed(seed);
+}
+
+inline void LorenzRandom::SetSeed(const uint64 seed) {
+    generatorState = (seed != 0u) ? (seed) : (0x9E3779B97F4A7C15ull);
+    hasSpare = false;
+}
+
+inline uint64 LorenzRandom::Next() {
+    generatorState ^= generatorState >> 12u;
+    generatorState ^= generatorState << 25u;
+    generatorState ^= generatorState >> 27u;
+    return generatorState * 0x2545F4914F6CDD1Dull;
+}
+
+inline float64 LorenzRandom::Uniform() {
+    // 53 random bits
+    return static_cast<float64>(Next() >> 11u) * (1.0 / 9007199254740992.0);
+}
+
+inline float64 LorenzRandom::Gaussian() {
+    float64 sample;
+    if (hasSpare) {
+        hasSpare = false;
+        sample = spare;
+    }
+    else {
+        float64 u;
+        float64 v;
+        float64 s;
+        do {
+            u = (2.0 * Uniform()) - 1.0;
+            v = (2.0 * Uniform()) - 1.0;
+            s = (u * u) + (v * v);
+        }
+        while ((s >= 1.0) || (s == 0.0));
+        const float64 factor = sqrt((-2.0 * log(s)) / s);
+        spare = v * factor;
+        hasSpare = true;
+        sample = u * factor;
+    }
+    return sample;
+}
+
+}
+
+#endif /* LORENZRANDOM_H_ */
@@ -0,0 +1,441 @@
+/**
+ * @file LorenzSweep.cpp
+ * @brief Source file for class LorenzSweep
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This source file contains the definition of all the methods for
+ * the class LorenzSweep (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "Sleep.h"
+#include "StreamString.h"
+#include "Threads.h"
+#include "LorenzArrayFile.h"
+#include "LorenzSweep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * Largest grid accepted by Start().
+ */
+const MARTe::uint32 MaximumNumberOfPoints = 0x1000000u;
+
+/**
+ * Number of steps between two checks of the cancellation flag.
+ */
+const MARTe::uint32 CancellationInterval = 1024u;
+
+/**
+ * Indices of the float64 result fields.
+ */
+enum ResultField {
+    SigmaResult = 0,
+    RhoResult,
+    BetaResult,
+    XMinResult,
+    XMaxResult,
+    YMinResult,
+    YMaxResult,
+    ZMinResult,
+    ZMaxResult,
+    HitXMinResult,
+    HitXMaxResult,
+    LyapunovResult
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LorenzSweep::LorenzSweep() {
+    uint32 a;
+    for (a = 0u; a < 3u; a++) {
+        configuration.axes[a].from = 0.0;
+        configuration.axes[a].to = 0.0;
+        configuration.axes[a].points = 0u;
+        configuration.initialState[a] = 1.0;
+    }
+    configuration.timeStep = 0.0;
+    configuration.tableau = LorenzKernels::RungeKutta4;
+    configuration.transientTime = 0.0;
+    configuration.measurementTime = 0.0;
+    configuration.numberOfThreads = 0u;
+    configuration.cpuMask = 0u;
+    configuration.reservedCPUs = 0u;
+    numberOfPoints = 0u;
+    results = NULL_PTR(float64 *);
+    hits = NULL_PTR(uint32 *);
+    nextPoint = 0u;
+    runningThreads = 0u;
+    alive = 0;
+    completedPoints = 0;
+    cancel = 0;
+    failed = 0;
+    state = static_cast<int32>(Idle);
+    if (!sweepSem.Create()) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to create the sweep semaphore");
+    }
+}
+
+LorenzSweep::~LorenzSweep() {
+    Cancel();
+    while (alive > 0) {
+        Sleep::MSec(1);
+    }
+    Clean();
+}
+
+void LorenzSweep::Clean() {
+    delete[] results;
+    delete[] hits;
+    results = NULL_PTR(float64 *);
+    hits = NULL_PTR(uint32 *);
+}
+
+bool LorenzSweep::Start(const Configuration &configurationIn) {
+    // alive is only zero once the last thread of the previous sweep has written its results
+    bool ok = (alive == 0);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::IllegalOperation, "A sweep is already running");
+    }
+    uint64 points = 1u;
+    if (ok) {
+        ok = ((configurationIn.cpuMask != 0u) && ((configurationIn.cpuMask & configurationIn.reservedCPUs) == 0u)
+                && (configurationIn.numberOfThreads > 0u) && (configurationIn.timeStep > 0.0) && (configurationIn.transientTime >= 0.0) && (configurationIn.measurementTime > 0.0));
+        uint32 a;
+        for (a = 0u; (a < 3u) && (ok); a++) {
+            points *= configurationIn.axes[a].points;
+            ok = ((configurationIn.axes[a].points > 0u) && (points <= MaximumNumberOfPoints));
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Invalid sweep: CPUs != 0 and not reserved, NumberOfThreads > 0, TimeStep > 0, TransientTime >= 0, "
+                                "MeasurementTime > 0 and 0 < number of points <= %u", MaximumNumberOfPoints);
+        }
+    }
+    if (ok) {
+        Clean();
+        configuration = configurationIn;
+        numberOfPoints = static_cast<uint32>(points);
+        results = new float64[NumberOfResultFields * numberOfPoints];
+        hits = new uint32[numberOfPoints];
+        nextPoint = 0u;
+        runningThreads = configuration.numberOfThreads;
+        completedPoints = 0;
+        cancel = 0;
+        failed = 0;
+        state = static_cast<int32>(Running);
+        uint32 cpu = 0u;
+        uint32 t;
+        for (t = 0u; (t < configuration.numberOfThreads) && (ok); t++) {
+            // Next CPU in the mask, wrapping around
+            uint32 tries;
+            for (tries = 0u; (tries < 32u) && (((configuration.cpuMask >> cpu) & 1u) == 0u); tries++) {
+                cpu = (cpu + 1u) % 32u;
+            }
+            ProcessorType cpus(1u << cpu);
+            cpu = (cpu + 1u) % 32u;
+            StreamString threadName;
+            (void) threadName.Printf("LorenzSweep%d", t);
+            Atomic::Increment(&alive);
+            ThreadIdentifier tid = Threads::BeginThread(&ThreadLoop, this, THREADS_DEFAULT_STACKSIZE, threadName.Buffer(), ExceptionHandler::NotHandled,
+                                                        cpus);
+            ok = (tid != InvalidThreadIdentifier);
+            if (!ok) {
+                Atomic::Decrement(&alive);
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to launch sweep thread %d", t);
+                // The threads already launched stop at their next check and the last one marks the sweep as failed
+                failed = 1;
+                cancel = 1;
+                if (sweepSem.FastLock().ErrorsCleared()) {
+                    runningThreads -= (configuration.numberOfThreads - t);
+                    if (runningThreads == 0u) {
+                        state = static_cast<int32>(Failed);
+                    }
+                    sweepSem.FastUnLock();
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+void LorenzSweep::Cancel() {
+    cancel = 1;
+}
+
+LorenzSweep::SweepState LorenzSweep::GetState() const {
+    return static_cast<SweepState>(state);
+}
+
+uint32 LorenzSweep::GetNumberOfPoints() const {
+    return numberOfPoints;
+}
+
+uint32 LorenzSweep::GetCompletedPoints() const {
+    return static_cast<uint32>(completedPoints);
+}
+
+void LorenzSweep::ThreadLoop(const void * const arguments) {
+    LorenzSweep *sweep = const_cast<LorenzSweep *>(static_cast<const LorenzSweep *>(arguments));
+    // Never compete with the real-time threads, even if the mask was not set correctly
+    Threads::SetPriority(Threads::Id(), Threads::IdlePriorityClass, 0u);
+    float64 *buffers = new float64[BatchSize * 3u * 8u];
+    bool ok = true;
+    while (ok) {
+        uint32 first = 0u;
+        uint32 count = 0u;
+        if (sweep->sweepSem.FastLock().ErrorsCleared()) {
+            first = sweep->nextPoint;
+            count = sweep->numberOfPoints - first;
+            if (count > BatchSize) {
+                count = BatchSize;
+            }
+            sweep->nextPoint += count;
+            sweep->sweepSem.FastUnLock();
+        }
+        ok = (count > 0u);
+        if (ok) {
+            ok = sweep->IntegrateBatch(first, count, buffers);
+        }
+        if ((ok) && (sweep->sweepSem.FastLock().ErrorsCleared())) {
+            sweep->completedPoints += static_cast<int32>(count);
+            sweep->sweepSem.FastUnLock();
+        }
+    }
+    delete[] buffers;
+    bool last = false;
+    if (sweep->sweepSem.FastLock().ErrorsCleared()) {
+        sweep->runningThreads--;
+        last = (sweep->runningThreads == 0u);
+        sweep->sweepSem.FastUnLock();
+    }
+    if (last) {
+        sweep->Finish();
+    }
+    Atomic::Decrement(&sweep->alive);
+}
+
+bool LorenzSweep::IntegrateBatch(const uint32 first, const uint32 count, float64 * const buffers) {
+    const uint32 n = count;
+    float64 *s = buffers;
+    float64 *stageBuffer[2] = { &buffers[3u * BatchSize], &buffers[6u * BatchSize] };
+    float64 * const accumulator = &buffers[9u * BatchSize];
+    float64 * const parameters = &buffers[12u * BatchSize];
+    float64 *tangent[2] = { &buffers[15u * BatchSize], &buffers[18u * BatchSize] };
+    const float64 h = configuration.timeStep;
+    const uint32 rhoPoints = configuration.axes[1u].points;
+    const uint32 betaPoints = configuration.axes[2u].points;
+    const float64 component = 1.0 / sqrt(3.0);
+    uint32 i;
+    uint32 c;
+    for (i = 0u; i < n; i++) {
+        const uint32 g = first + i;
+        const uint32 index[3] = { g / (rhoPoints * betaPoints), (g / betaPoints) % rhoPoints, g % betaPoints };
+        for (c = 0u; c < 3u; c++) {
+            const Axis &axis = configuration.axes[c];
+            parameters[(c * n) + i] = axis.from;
+            if (axis.points > 1u) {
+                parameters[(c * n) + i] += ((axis.to - axis.from) * static_cast<float64>(index[c])) / static_cast<float64>(axis.points - 1u);
+            }
+            s[(c * n) + i] = configuration.initialState[c];
+            tangent[0][(c * n) + i] = component;
+        }
+    }
+    LorenzKernels::StageArguments<float64> args;
+    args.parameters.sigma = 0.0;
+    args.parameters.rho = 0.0;
+    args.parameters.beta = 0.0;
+    args.elementParameters = parameters;
+    args.coupling.rowStart = NULL_PTR(const uint32 *);
+    args.coupling.columns = NULL_PTR(const uint32 *);
+    args.coupling.weights = NULL_PTR(const float64 *);
+    args.coupling.degree = NULL_PTR(const float64 *);
+    args.coupling.strength = 0.0;
+    args.accumulator = accumulator;
+    args.compensation = NULL_PTR(float64 *);
+    args.stride = n;
+    args.timeStep = h;
+
+    // The transient is a whole number of renormalisation intervals so that the measured growth starts from a unit tangent
+    uint32 transientSteps = static_cast<uint32>(ceil(configuration.transientTime / h));
+    transientSteps = ((transientSteps + RenormalisationInterval) - 1u) - (((transientSteps + RenormalisationInterval) - 1u) % RenormalisationInterval);
+    uint32 measurementSteps = static_cast<uint32>(ceil(configuration.measurementTime / h));
+    const uint32 numberOfSteps = transientSteps + measurementSteps;
+
+    float64 minimum[3][BatchSize];
+    float64 maximum[3][BatchSize];
+    float64 hitMinimum[BatchSize];
+    float64 hitMaximum[BatchSize];
+    float64 logGrowth[BatchSize];
+    uint32 hitCount[BatchSize];
+    const uint32 numberOfStages = configuration.tableau.numberOfStages;
+    const uint32 last = (numberOfStages - 1u) % 2u;
+    bool ok = true;
+    uint32 step;
+    for (step = 0u; (step < numberOfSteps) && (ok); step++) {
+        const bool measuring = (step >= transientSteps);
+        if (step == transientSteps) {
+            for (i = 0u; i < n; i++) {
+                for (c = 0u; c < 3u; c++) {
+                    minimum[c][i] = s[(c * n) + i];
+                    maximum[c][i] = s[(c * n) + i];
+                }
+                hitMinimum[i] = 0.0;
+                hitMaximum[i] = 0.0;
+                logGrowth[i] = 0.0;
+                hitCount[i] = 0u;
+            }
+        }
+        const float64 *input = s;
+        uint32 stage;
+        for (stage = 0u; stage < numberOfStages; stage++) {
+            args.input = input;
+            args.base = s;
+            args.output = stageBuffer[stage % 2u];
+            args.advance = configuration.tableau.advance[stage];
+            args.weight = configuration.tableau.weight[stage];
+            LorenzKernels::Stage(args, LorenzKernels::GetStageKind(stage, numberOfStages), 0u, n);
+            input = args.output;
+        }
+        float64 * const previous = s;
+        s = stageBuffer[last];
+        stageBuffer[last] = previous;
+        LorenzKernels::Tangent(args.parameters, args.elementParameters, previous, s, tangent[0], tangent[1], n, h, 0u, n);
+        float64 * const previousTangent = tangent[0];
+        tangent[0] = tangent[1];
+        tangent[1] = previousTangent;
+
+        if (measuring) {
+            for (c = 0u; c < 3u; c++) {
+                const float64 * const sc = &s[c * n];
+                for (i = 0u; i < n; i++) {
+                    minimum[c][i] = (sc[i] < minimum[c][i]) ? (sc[i]) : (minimum[c][i]);
+                    maximum[c][i] = (sc[i] > maximum[c][i]) ? (sc[i]) : (maximum[c][i]);
+                }
+            }
+            // Upward crossings of z = rho - 1, located by linear interpolation
+            for (i = 0u; i < n; i++) {
+                const float64 section = parameters[n + i] - 1.0;
+                const float64 z0 = previous[(2u * n) + i];
+                const float64 z1 = s[(2u * n) + i];
+                if ((z0 < section) && (z1 >= section)) {
+                    const float64 theta = (section - z0) / (z1 - z0);
+                    const float64 x = previous[i] + (theta * (s[i] - previous[i]));
+                    if ((hitCount[i] == 0u) || (x < hitMinimum[i])) {
+                        hitMinimum[i] = x;
+                    }
+                    if ((hitCount[i] == 0u) || (x > hitMaximum[i])) {
+                        hitMaximum[i] = x;
+                    }
+                    hitCount[i]++;
+                }
+            }
+        }
+        if ((((step + 1u) % RenormalisationInterval) == 0u) || ((step + 1u) == numberOfSteps)) {
+            float64 * const vx = tangent[0];
+            float64 * const vy = &vx[n];
+            float64 * const vz = &vx[2u * n];
+            for (i = 0u; i < n; i++) {
+                const float64 norm = sqrt(((vx[i] * vx[i]) + (vy[i] * vy[i])) + (vz[i] * vz[i]));
+                if (norm > 0.0) {
+                    vx[i] /= norm;
+                    vy[i] /= norm;
+                    vz[i] /= norm;
+                    if (measuring) {
+                        logGrowth[i] += log(norm);
+                    }
+                }
+            }
+        }
+        if ((step % CancellationInterval) == 0u) {
+            ok = (cancel == 0);
+        }
+    }
+    if (ok) {
+        const float64 measuredTime = static_cast<float64>(measurementSteps) * h;
+        for (i = 0u; i < n; i++) {
+            const uint32 g = first + i;
+            for (c = 0u; c < 3u; c++) {
+                results[(static_cast<uint32>(SigmaResult + c) * numberOfPoints) + g] = parameters[(c * n) + i];
+                results[(static_cast<uint32>(XMinResult + (2u * c)) * numberOfPoints) + g] = minimum[c][i];
+                results[(static_cast<uint32>(XMaxResult + (2u * c)) * numberOfPoints) + g] = maximum[c][i];
+            }
+            results[(static_cast<uint32>(HitXMinResult) * numberOfPoints) + g] = hitMinimum[i];
+            results[(static_cast<uint32>(HitXMaxResult) * numberOfPoints) + g] = hitMaximum[i];
+            results[(static_cast<uint32>(LyapunovResult) * numberOfPoints) + g] = logGrowth[i] / measuredTime;
+            hits[g] = hitCount[i];
+        }
+    }
+    return ok;
+}
+
+void LorenzSweep::Finish() {
+    if (failed != 0) {
+        state = static_cast<int32>(Failed);
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Sweep failed after %d of %u points", completedPoints, numberOfPoints);
+    }
+    else if (cancel != 0) {
+        state = static_cast<int32>(Cancelled);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Sweep cancelled after %d of %u points", completedPoints, numberOfPoints);
+    }
+    else {
+        const char8 * const names[NumberOfResultFields + 1u] = { "Sigma", "Rho", "Beta", "XMin", "XMax", "YMin", "YMax", "ZMin", "ZMax", "HitXMin",
+                "HitXMax", "Lyapunov", "Hits" };
+        uint32 types[NumberOfResultFields + 1u];
+        const void *arrays[NumberOfResultFields + 1u];
+        uint32 f;
+        for (f = 0u; f < NumberOfResultFields; f++) {
+            types[f] = static_cast<uint32>(LorenzArrayFile::Float64Field);
+            arrays[f] = &results[f * numberOfPoints];
+        }
+        types[NumberOfResultFields] = static_cast<uint32>(LorenzArrayFile::UnsignedInteger32Field);
+        arrays[NumberOfResultFields] = hits;
+        if (LorenzArrayFile::Write(configuration.fileName.Buffer(), numberOfPoints, NumberOfResultFields + 1u, &names[0], &types[0], &arrays[0])) {
+            state = static_cast<int32>(Completed);
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Sweep of %u points written to %s", numberOfPoints, configuration.fileName.Buffer());
+        }
+        else {
+            state = static_cast<int32>(Failed);
+        }
+    }
+}
+
+}
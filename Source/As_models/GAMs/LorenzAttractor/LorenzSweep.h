@@ -0,0 +1,266 @@
+/**
+ * @file LorenzSweep.h
+ * @brief Header file for class LorenzSweep
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This header file contains the declaration of the class
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LORENZSWEEP_H_
+#define LORENZSWEEP_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "FastPollingMutexSem.h"
+#include "GeneralDefinitions.h"
+#include "StreamString.h"
+#include "LorenzKernels.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Background sweep of the Lorenz parameters over a regular (sigma, rho, beta) grid.
+ * @details The grid points are integrated in batches of BatchSize, each batch as a structure-of-arrays ensemble
+ * with per-element parameters using the LorenzKernels stage and tangent kernels. After a transient, each point
+ * is reduced on the fly to:
+ *  - the extrema of x, y and z;
+ *  - the number of upward crossings of the Poincare section z = rho - 1 and the extrema of x on the section;
+ *  - the largest Lyapunov exponent (tangent vector renormalised every RenormalisationInterval steps).
+ *
+ * The batches are shared dynamically by NumberOfThreads threads which run at idle priority, pinned to the
+ * configured CPU mask, which shall not overlap the reserved (real-time and worker) CPUs. When all the points
+ * are done the results are written with LorenzArrayFile, one record per grid point with the fields Sigma, Rho,
+ * Beta, XMin, XMax, YMin, YMax, ZMin, ZMax, HitXMin, HitXMax, Lyapunov (float64) and Hits (uint32). The grid index is
+ * (sigmaIndex * rhoPoints + rhoIndex) * betaPoints + betaIndex.
+ *
+ * A sweep can be cancelled at any time (no file is written). The progress is the number of completed points.
+ */
+class LorenzSweep {
+public:
+
+    /**
+     * @brief State of the sweep.
+     */
+    enum SweepState {
+        /** No sweep was started. */
+        Idle = 0,
+        /** The threads are integrating. */
+        Running = 1,
+        /** The results were written. */
+        Completed = 2,
+        /** Cancel() was called before completion. */
+        Cancelled = 3,
+        /** The threads could not be started or the file could not be written. */
+        Failed = 4
+    };
+
+    /**
+     * @brief A grid axis. With one point the value is \a from.
+     */
+    struct Axis {
+        float64 from;
+        float64 to;
+        uint32 points;
+    };
+
+    /**
+     * @brief Description of a sweep.
+     */
+    struct Configuration {
+        /** Sigma, rho and beta axes. */
+        Axis axes[3];
+        /** Initial state of every point. */
+        float64 initialState[3];
+        /** Integration step. */
+        float64 timeStep;
+        /** Integration method. */
+        LorenzKernels::Tableau tableau;
+        /** Time integrated before the statistics are collected. */
+        float64 transientTime;
+        /** Time over which the statistics are collected. */
+        float64 measurementTime;
+        /** Number of threads. */
+        uint32 numberOfThreads;
+        /** CPUs of the threads (thread k on the k-th CPU set, round-robin). */
+        uint32 cpuMask;
+        /** CPUs which the threads shall not use (the real-time and worker cores). */
+        uint32 reservedCPUs;
+        /** Output file. */
+        StreamString fileName;
+    };
+
+    /**
+     * Number of grid points integrated together.
+     */
+    static const uint32 BatchSize = 64u;
+
+    /**
+     * Number of steps between two renormalisations of the tangent vectors.
+     */
+    static const uint32 RenormalisationInterval = 16u;
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LorenzSweep();
+
+    /**
+     * @brief Destructor. Cancels the sweep and waits for the threads.
+     */
+    ~LorenzSweep();
+
+    /**
+     * @brief Starts a sweep.
+     * @return false if a sweep is running, if the configuration is invalid or if the threads could not be started.
+     * @pre
+     *   configuration.cpuMask != 0 && (cpuMask & reservedCPUs) == 0 && numberOfThreads > 0 && timeStep > 0 && transientTime >= 0 && measurementTime > 0 &&
+     *   every axis has at least one point.
+     */
+    bool Start(const Configuration &configurationIn);
+
+    /**
+     * @brief Requests the cancellation of the running sweep (returns immediately).
+     */
+    void Cancel();
+
+    /**
+     * @brief Gets the SweepState.
+     */
+    SweepState GetState() const;
+
+    /**
+     * @brief Gets the number of grid points.
+     */
+    uint32 GetNumberOfPoints() const;
+
+    /**
+     * @brief Gets the number of points completed so far.
+     */
+    uint32 GetCompletedPoints() const;
+
+private:
+
+    /**
+     * @brief Thread body: processes batches until none is left, the last thread to finish writes the results.
+     */
+    static void ThreadLoop(const void * const arguments);
+
+    /**
+     * @brief Integrates the points [first, first + count) and stores their statistics.
+     * @param[in] buffers scratch memory (BatchSize * 3 * 8 elements).
+     * @return false if the sweep was cancelled.
+     */
+    bool IntegrateBatch(const uint32 first, const uint32 count, float64 * const buffers);
+
+    /**
+     * @brief Writes the results (unless the sweep failed or was cancelled) and updates the state.
+     */
+    void Finish();
+
+    /**
+     * @brief Frees the results.
+     */
+    void Clean();
+
+    /**
+     * Number of float64 result fields.
+     */
+    static const uint32 NumberOfResultFields = 12u;
+
+    /**
+     * The running sweep.
+     */
+    Configuration configuration;
+
+    /**
+     * Number of grid points.
+     */
+    uint32 numberOfPoints;
+
+    /**
+     * Float64 results, field-major.
+     */
+    float64 *results;
+
+    /**
+     * Number of section hits per point.
+     */
+    uint32 *hits;
+
+    /**
+     * Protects nextPoint and runningThreads.
+     */
+    FastPollingMutexSem sweepSem;
+
+    /**
+     * First point of the next batch.
+     */
+    uint32 nextPoint;
+
+    /**
+     * Threads still integrating.
+     */
+    uint32 runningThreads;
+
+    /**
+     * Threads not yet terminated.
+     */
+    volatile int32 alive;
+
+    /**
+     * Points completed.
+     */
+    volatile int32 completedPoints;
+
+    /**
+     * Set by Cancel().
+     */
+    volatile int32 cancel;
+
+    /**
+     * Set by Start() if some threads could not be launched.
+     */
+    volatile int32 failed;
+
+    /**
+     * A SweepState.
+     */
+    volatile int32 state;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LORENZSWEEP_H_ */
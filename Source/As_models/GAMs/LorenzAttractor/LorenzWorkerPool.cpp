@@ -0,0 +1,213 @@
+/**
+ * @file LorenzWorkerPool.cpp
+ * @brief Source file for class LorenzWorkerPool
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This source file contains the definition of all the methods for
+ * the class LorenzWorkerPool (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "Sleep.h"
+#include "StreamString.h"
+#include "LorenzWorkerPool.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace {
+
+/**
+ * @brief Full memory barrier: the accesses before it are visible to the other threads before those after it.
+ * @details The volatile accesses alone only order the stores on TSO architectures (e.g. x86).
+ */
+inline void Fence() {
+    __sync_synchronize();
+}
+
+/**
+ * @brief Gives the CPU of an unpinned worker back to the scheduler while it waits for a job.
+ */
+inline void Yield() {
+#ifdef __linux__
+    (void) sched_yield();
+#else
+    MARTe::Sleep::MSec(0);
+#endif
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LorenzWorkerPool::LorenzWorkerPool() {
+    numberOfWorkers = 0u;
+    numberOfItems = 0u;
+    workerArguments = NULL_PTR(WorkerArguments *);
+    currentJob = NULL_PTR(JobFunction);
+    currentContext = NULL_PTR(void *);
+    generation = 0;
+    pending = 0;
+    alive = 0;
+    quit = 0;
+}
+
+LorenzWorkerPool::~LorenzWorkerPool() {
+    Stop();
+}
+
+bool LorenzWorkerPool::Start(const uint32 numberOfWorkersIn, const uint32 numberOfItemsIn, const uint32 cpuMask) {
+    Stop();
+    numberOfItems = numberOfItemsIn;
+    numberOfWorkers = numberOfWorkersIn;
+    generation = 0;
+    bool ok = true;
+    if (numberOfWorkers > 0u) {
+        workerArguments = new WorkerArguments[numberOfWorkers];
+        uint32 cpu = 0u;
+        uint32 w;
+        for (w = 0u; (w < numberOfWorkers) && (ok); w++) {
+            workerArguments[w].pool = this;
+            workerArguments[w].partition = w + 1u;
+            workerArguments[w].pinned = (cpuMask != 0u);
+            ProcessorType cpus = UndefinedCPUs;
+            if (cpuMask != 0u) {
+                // Next CPU in the mask, wrapping around
+                uint32 tries;
+                for (tries = 0u; (tries < 32u) && (((cpuMask >> cpu) & 1u) == 0u); tries++) {
+                    cpu = (cpu + 1u) % 32u;
+                }
+                cpus = ProcessorType(1u << cpu);
+                cpu = (cpu + 1u) % 32u;
+            }
+            StreamString threadName;
+            (void) threadName.Printf("LorenzWorker%d", w);
+            Atomic::Increment(&alive);
+            ThreadIdentifier tid = Threads::BeginThread(&WorkerLoop, &workerArguments[w], THREADS_DEFAULT_STACKSIZE, threadName.Buffer(),
+                                                        ExceptionHandler::NotHandled, cpus);
+            ok = (tid != InvalidThreadIdentifier);
+            if (!ok) {
+                Atomic::Decrement(&alive);
+                REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to launch worker %d", w);
+            }
+        }
+    }
+    if (!ok) {
+        Stop();
+    }
+    return ok;
+}
+
+void LorenzWorkerPool::Stop() {
+    quit = 1;
+    while (alive > 0) {
+        Sleep::MSec(1);
+    }
+    quit = 0;
+    delete[] workerArguments;
+    workerArguments = NULL_PTR(WorkerArguments *);
+    numberOfWorkers = 0u;
+}
+
+void LorenzWorkerPool::SetNumberOfItems(const uint32 numberOfItemsIn) {
+    numberOfItems = numberOfItemsIn;
+}
+
+uint32 LorenzWorkerPool::GetNumberOfPartitions() const {
+    return numberOfWorkers + 1u;
+}
+
+void LorenzWorkerPool::GetPartition(const uint32 partition, uint32 &begin, uint32 &end) const {
+    const uint32 partitions = numberOfWorkers + 1u;
+    const uint32 chunk = numberOfItems / partitions;
+    const uint32 remainder = numberOfItems % partitions;
+    begin = (partition * chunk) + ((partition < remainder) ? (partition) : (remainder));
+    end = begin + chunk + ((partition < remainder) ? (1u) : (0u));
+}
+
+void LorenzWorkerPool::Run(const JobFunction job, void * const context) {
+    uint32 begin;
+    uint32 end;
+    GetPartition(0u, begin, end);
+    if (numberOfWorkers > 0u) {
+        currentJob = job;
+        currentContext = context;
+        pending = static_cast<int32>(numberOfWorkers);
+        // Release: the job (and e.g. the number of items) is visible to the workers before the new generation
+        Fence();
+        Atomic::Increment(&generation);
+        job(context, 0u, begin, end);
+        while (pending > 0) {
+        }
+        // Acquire: the results of the workers are read after their completion
+        Fence();
+    }
+    else {
+        job(context, 0u, begin, end);
+    }
+}
+
+void LorenzWorkerPool::WorkerLoop(const void * const arguments) {
+    const WorkerArguments *args = static_cast<const WorkerArguments *>(arguments);
+    LorenzWorkerPool *pool = args->pool;
+    int32 seen = 0;
+    while (pool->quit == 0) {
+        if (pool->generation != seen) {
+            seen = pool->generation;
+            // Acquire: the job is read after the generation which published it
+            Fence();
+            uint32 begin;
+            uint32 end;
+            pool->GetPartition(args->partition, begin, end);
+            pool->currentJob(pool->currentContext, args->partition, begin, end);
+            // Release: the results are visible to the caller of Run() before the completion
+            Fence();
+            Atomic::Decrement(&pool->pending);
+        }
+        else if (!args->pinned) {
+            Yield();
+        }
+        else {
+            // Pinned on a dedicated core: spin
+        }
+    }
+    Atomic::Decrement(&pool->alive);
+}
+
+}
@@ -0,0 +1,183 @@
+/**
+ * @file LorenzWorkerPool.h
+ * @brief Header file for class LorenzWorkerPool
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This header file contains the declaration of the class
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LORENZWORKERPOOL_H_
+#define LORENZWORKERPOOL_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GeneralDefinitions.h"
+#include "ProcessorType.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Pool of spinning worker threads which split a range of items in contiguous partitions.
+ * @details The range [0, numberOfItems) is split in GetNumberOfPartitions() contiguous partitions.
+ * Partition 0 is always executed by the thread calling Run(), partition k > 0 by worker k - 1.
+ * Run() returns when all the partitions have been processed, i.e. it acts as a barrier.
+ *
+ * The pinned workers busy-wait for new jobs (no system calls on the real-time path) and are thus
+ * expected to be pinned on dedicated (isolated) cores; the workers which are not pinned yield their
+ * CPU while they wait, at the cost of the latency of the jobs. The job is published to the workers,
+ * and their results to the caller of Run(), with explicit memory barriers. With zero workers Run()
+ * simply calls the job on the full range.
+ */
+class LorenzWorkerPool {
+public:
+
+    /**
+     * @brief Job executed on the partition \a partition, which covers the items [begin, end).
+     */
+    typedef void (*JobFunction)(void * const context, const uint32 partition, const uint32 begin, const uint32 end);
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LorenzWorkerPool();
+
+    /**
+     * @brief Destructor. Calls Stop().
+     */
+    ~LorenzWorkerPool();
+
+    /**
+     * @brief Computes the partitions and launches the workers.
+     * @param[in] numberOfWorkersIn the number of worker threads (besides the caller of Run()).
+     * @param[in] numberOfItemsIn the number of items to split.
+     * @param[in] cpuMask if not zero, worker k is pinned to the k-th CPU set in the mask (round-robin) and busy-waits,
+     * otherwise the workers are not pinned and yield while they wait.
+     * @return true if all the threads could be launched.
+     */
+    bool Start(const uint32 numberOfWorkersIn, const uint32 numberOfItemsIn, const uint32 cpuMask);
+
+    /**
+     * @brief Executes the job on all the partitions and waits for completion.
+     */
+    void Run(const JobFunction job, void * const context);
+
+    /**
+     * @brief Changes the number of items to split from the next Run().
+     * @pre Run() is not being executed.
+     */
+    void SetNumberOfItems(const uint32 numberOfItemsIn);
+
+    /**
+     * @brief Terminates and joins the workers.
+     */
+    void Stop();
+
+    /**
+     * @brief Gets the number of partitions (number of workers + 1).
+     */
+    uint32 GetNumberOfPartitions() const;
+
+    /**
+     * @brief Gets the boundaries of the partition \a partition.
+     */
+    void GetPartition(const uint32 partition, uint32 &begin, uint32 &end) const;
+
+private:
+
+    /**
+     * @brief Thread arguments.
+     */
+    struct WorkerArguments {
+        LorenzWorkerPool *pool;
+        uint32 partition;
+        bool pinned;
+    };
+
+    /**
+     * @brief Worker thread body.
+     */
+    static void WorkerLoop(const void * const arguments);
+
+    /**
+     * Number of worker threads.
+     */
+    uint32 numberOfWorkers;
+
+    /**
+     * Number of items (read by the workers at every job).
+     */
+    volatile uint32 numberOfItems;
+
+    /**
+     * Arguments of each worker.
+     */
+    WorkerArguments *workerArguments;
+
+    /**
+     * Current job, published before generation is incremented.
+     */
+    volatile JobFunction currentJob;
+
+    /**
+     * Current job context.
+     */
+    void * volatile currentContext;
+
+    /**
+     * Incremented for every job.
+     */
+    volatile int32 generation;
+
+    /**
+     * Number of workers which have not yet completed the current job.
+     */
+    volatile int32 pending;
+
+    /**
+     * Number of workers alive.
+     */
+    volatile int32 alive;
+
+    /**
+     * Set to request the workers to terminate.
+     */
+    volatile int32 quit;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LORENZWORKERPOOL_H_ */
@@ -0,0 +1,399 @@
+/**
+ * @file LorenzEnKF.cpp
+ * @brief Source file for class LorenzEnKF
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This source file contains the definition of all the methods for
+ * the class LorenzEnKF (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "Vector.h"
+#include "LorenzEnKF.h"
+#include "LorenzRandom.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+LorenzEnKF::LorenzEnKF() :
+        GAM() {
+    parameters.sigma = 10.0;
+    parameters.rho = 28.0;
+    parameters.beta = 8.0 / 3.0;
+    timeStep = 0.0;
+    numberOfSubSteps = 1u;
+    tableau = LorenzKernels::RungeKutta4;
+    numberOfMembers = 0u;
+    seed = 1u;
+    inflation = 1.0;
+    uint32 c;
+    for (c = 0u; c < 3u; c++) {
+        initialMean[c] = 1.0;
+        initialSpread[c] = 1.0;
+        measurementNoise[c] = 0.0;
+        measurements[c] = NULL_PTR(const float64 *);
+    }
+    state = NULL_PTR(float64 *);
+    stageBuffer[0] = NULL_PTR(float64 *);
+    stageBuffer[1] = NULL_PTR(float64 *);
+    accumulator = NULL_PTR(float64 *);
+    stageArguments.coupling.rowStart = NULL_PTR(const uint32 *);
+    stageArguments.coupling.columns = NULL_PTR(const uint32 *);
+    stageArguments.coupling.weights = NULL_PTR(const float64 *);
+    stageArguments.coupling.degree = NULL_PTR(const float64 *);
+    stageArguments.coupling.strength = 0.0;
+    estimateOutput = NULL_PTR(float64 *);
+    covarianceOutput = NULL_PTR(float64 *);
+}
+
+LorenzEnKF::~LorenzEnKF() {
+    delete[] state;
+    delete[] stageBuffer[0];
+    delete[] stageBuffer[1];
+    delete[] accumulator;
+}
+
+bool LorenzEnKF::Initialise(StructuredDataI &data) {
+    bool ok = GAM::Initialise(data);
+    if (ok) {
+        ok = data.Read("TimeStep", timeStep);
+        if (ok) {
+            ok = (timeStep > 0.0);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "TimeStep shall be set and > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Sigma", parameters.sigma)) {
+            REPORT_ERROR(ErrorManagement::Information, "Sigma not set. Using default %f", parameters.sigma);
+        }
+        if (!data.Read("Rho", parameters.rho)) {
+            REPORT_ERROR(ErrorManagement::Information, "Rho not set. Using default %f", parameters.rho);
+        }
+        if (!data.Read("Beta", parameters.beta)) {
+            REPORT_ERROR(ErrorManagement::Information, "Beta not set. Using default %f", parameters.beta);
+        }
+        if (!data.Read("NumberOfSubSteps", numberOfSubSteps)) {
+            numberOfSubSteps = 1u;
+        }
+        ok = (numberOfSubSteps > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfSubSteps shall be > 0");
+        }
+    }
+    if (ok) {
+        StreamString integrator;
+        if (data.Read("Integrator", integrator)) {
+            ok = LorenzKernels::GetTableau(integrator.Buffer(), tableau);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported Integrator %s", integrator.Buffer());
+            }
+        }
+    }
+    if (ok) {
+        ok = data.Read("NumberOfMembers", numberOfMembers);
+        if (ok) {
+            ok = (numberOfMembers > 1u);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfMembers shall be set and > 1");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Seed", seed)) {
+            seed = 1u;
+        }
+        if (!data.GetType("InitialMean").IsVoid()) {
+            Vector<float64> meanVector(&initialMean[0], 3u);
+            ok = ((data.GetType("InitialMean").GetNumberOfElements(0u) == 3u) && (data.Read("InitialMean", meanVector)));
+        }
+        if ((ok) && (!data.GetType("InitialSpread").IsVoid())) {
+            Vector<float64> spreadVector(&initialSpread[0], 3u);
+            ok = ((data.GetType("InitialSpread").GetNumberOfElements(0u) == 3u) && (data.Read("InitialSpread", spreadVector)));
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "InitialMean and InitialSpread shall have 3 elements");
+        }
+    }
+    if (ok) {
+        Vector<float64> noiseVector(&measurementNoise[0], 3u);
+        ok = ((data.GetType("MeasurementNoise").GetNumberOfElements(0u) == 3u) && (data.Read("MeasurementNoise", noiseVector)));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "MeasurementNoise shall be set with 3 elements");
+        }
+    }
+    if (ok) {
+        if (!data.Read("Inflation", inflation)) {
+            inflation = 1.0;
+        }
+        ok = (inflation >= 1.0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Inflation shall be >= 1");
+        }
+    }
+    return ok;
+}
+
+bool LorenzEnKF::Setup() {
+    const char8 * const componentNames[3] = { "X", "Y", "Z" };
+    const uint32 numberOfInputSignals = GetNumberOfInputSignals();
+    bool ok = (numberOfInputSignals > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "At least one of the X, Y, Z measurements shall be an input signal");
+    }
+    uint32 signalIndex;
+    for (signalIndex = 0u; (signalIndex < numberOfInputSignals) && (ok); signalIndex++) {
+        StreamString signalName;
+        uint32 signalNumberOfElements = 0u;
+        ok = (GetSignalName(InputSignals, signalIndex, signalName) && GetSignalNumberOfElements(InputSignals, signalIndex, signalNumberOfElements));
+        uint32 c = 3u;
+        if (ok) {
+            uint32 k;
+            for (k = 0u; k < 3u; k++) {
+                if (signalName == componentNames[k]) {
+                    c = k;
+                }
+            }
+            ok = ((c < 3u) && (GetSignalType(InputSignals, signalIndex) == Float64Bit) && (signalNumberOfElements == 1u));
+        }
+        if (ok) {
+            ok = ((measurements[c] == NULL_PTR(const float64 *)) && (measurementNoise[c] > 0.0));
+        }
+        if (ok) {
+            measurements[c] = static_cast<const float64 *>(GetInputSignalMemory(signalIndex));
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Input signal %s shall be one of X, Y, Z (float64, 1 element, MeasurementNoise > 0)",
+                         signalName.Buffer());
+        }
+    }
+    const uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+    for (signalIndex = 0u; (signalIndex < numberOfOutputSignals) && (ok); signalIndex++) {
+        StreamString signalName;
+        uint32 signalNumberOfElements = 0u;
+        ok = (GetSignalName(OutputSignals, signalIndex, signalName) && GetSignalNumberOfElements(OutputSignals, signalIndex, signalNumberOfElements));
+        if (ok) {
+            ok = (GetSignalType(OutputSignals, signalIndex) == Float64Bit);
+        }
+        if (ok) {
+            if ((signalName == "Estimate") && (signalNumberOfElements == 3u)) {
+                estimateOutput = static_cast<float64 *>(GetOutputSignalMemory(signalIndex));
+            }
+            else if ((signalName == "Covariance") && (signalNumberOfElements == 9u)) {
+                covarianceOutput = static_cast<float64 *>(GetOutputSignalMemory(signalIndex));
+            }
+            else {
+                ok = false;
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Output signal %s shall be Estimate (float64[3]) or Covariance (float64[9])",
+                         signalName.Buffer());
+        }
+    }
+    if (ok) {
+        ok = (estimateOutput != NULL_PTR(float64 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The Estimate output signal shall be set");
+        }
+    }
+    if (ok) {
+        const uint32 n = numberOfMembers;
+        state = new float64[3u * n];
+        stageBuffer[0] = new float64[3u * n];
+        stageBuffer[1] = new float64[3u * n];
+        accumulator = new float64[3u * n];
+        LorenzRandom random(static_cast<uint64>(seed));
+        uint32 i;
+        for (i = 0u; i < n; i++) {
+            uint32 c;
+            for (c = 0u; c < 3u; c++) {
+                state[(c * n) + i] = initialMean[c] + (initialSpread[c] * random.Gaussian());
+            }
+        }
+        stageArguments.parameters = parameters;
+        stageArguments.elementParameters = NULL_PTR(const float64 *);
+        stageArguments.accumulator = accumulator;
+        stageArguments.compensation = NULL_PTR(float64 *);
+        stageArguments.stride = n;
+        stageArguments.timeStep = timeStep;
+        Publish();
+    }
+    return ok;
+}
+
+void LorenzEnKF::Forecast() {
+    uint32 s;
+    for (s = 0u; s < numberOfSubSteps; s++) {
+        const float64 *input = state;
+        uint32 stage;
+        for (stage = 0u; stage < tableau.numberOfStages; stage++) {
+            stageArguments.input = input;
+            stageArguments.base = state;
+            stageArguments.output = stageBuffer[stage % 2u];
+            stageArguments.advance = tableau.advance[stage];
+            stageArguments.weight = tableau.weight[stage];
+            LorenzKernels::Stage(stageArguments, LorenzKernels::GetStageKind(stage, tableau.numberOfStages), 0u, numberOfMembers);
+            input = stageArguments.output;
+        }
+        const uint32 last = (tableau.numberOfStages - 1u) % 2u;
+        float64 *previousState = state;
+        state = stageBuffer[last];
+        stageBuffer[last] = previousState;
+    }
+}
+
+void LorenzEnKF::ComputeMean(float64 (&mean)[3]) const {
+    const uint32 n = numberOfMembers;
+    uint32 c;
+    for (c = 0u; c < 3u; c++) {
+        const float64 * const component = &state[c * n];
+        float64 sum = 0.0;
+        uint32 i;
+        for (i = 0u; i < n; i++) {
+            sum += component[i];
+        }
+        mean[c] = sum / static_cast<float64>(n);
+    }
+}
+
+void LorenzEnKF::Analyse() {
+    const uint32 n = numberOfMembers;
+    const float64 normalisation = 1.0 / static_cast<float64>(n - 1u);
+    float64 * const x = state;
+    float64 * const y = &state[n];
+    float64 * const z = &state[2u * n];
+    float64 mean[3];
+    ComputeMean(mean);
+    uint32 i;
+    if (inflation > 1.0) {
+        for (i = 0u; i < n; i++) {
+            x[i] = mean[0u] + (inflation * (x[i] - mean[0u]));
+            y[i] = mean[1u] + (inflation * (y[i] - mean[1u]));
+            z[i] = mean[2u] + (inflation * (z[i] - mean[2u]));
+        }
+    }
+    uint32 m;
+    for (m = 0u; m < 3u; m++) {
+        if (measurements[m] != NULL_PTR(const float64 *)) {
+            const float64 * const measured = &state[m * n];
+            // Column m of the forecast covariance, i.e. P H^T for the scalar measurement
+            float64 column[3] = { 0.0, 0.0, 0.0 };
+            for (i = 0u; i < n; i++) {
+                const float64 anomaly = measured[i] - mean[m];
+                column[0u] += (x[i] - mean[0u]) * anomaly;
+                column[1u] += (y[i] - mean[1u]) * anomaly;
+                column[2u] += (z[i] - mean[2u]) * anomaly;
+            }
+            const float64 noiseVariance = measurementNoise[m] * measurementNoise[m];
+            const float64 innovationVariance = (column[m] * normalisation) + noiseVariance;
+            float64 gain[3];
+            uint32 c;
+            for (c = 0u; c < 3u; c++) {
+                gain[c] = (column[c] * normalisation) / innovationVariance;
+            }
+            // The anomalies are updated with the reduced gain alpha * K so that their covariance is (I - K H) P
+            const float64 alpha = 1.0 / (1.0 + sqrt(noiseVariance / innovationVariance));
+            const float64 innovation = *measurements[m] - mean[m];
+            for (i = 0u; i < n; i++) {
+                const float64 correction = innovation - (alpha * (measured[i] - mean[m]));
+                x[i] += gain[0u] * correction;
+                y[i] += gain[1u] * correction;
+                z[i] += gain[2u] * correction;
+            }
+            for (c = 0u; c < 3u; c++) {
+                mean[c] += gain[c] * innovation;
+            }
+        }
+    }
+}
+
+void LorenzEnKF::Publish() {
+    const uint32 n = numberOfMembers;
+    float64 mean[3];
+    ComputeMean(mean);
+    uint32 c;
+    for (c = 0u; c < 3u; c++) {
+        estimateOutput[c] = mean[c];
+    }
+    if (covarianceOutput != NULL_PTR(float64 *)) {
+        const float64 * const x = state;
+        const float64 * const y = &state[n];
+        const float64 * const z = &state[2u * n];
+        float64 xx = 0.0;
+        float64 xy = 0.0;
+        float64 xz = 0.0;
+        float64 yy = 0.0;
+        float64 yz = 0.0;
+        float64 zz = 0.0;
+        uint32 i;
+        for (i = 0u; i < n; i++) {
+            const float64 dx = x[i] - mean[0u];
+            const float64 dy = y[i] - mean[1u];
+            const float64 dz = z[i] - mean[2u];
+            xx += dx * dx;
+            xy += dx * dy;
+            xz += dx * dz;
+            yy += dy * dy;
+            yz += dy * dz;
+            zz += dz * dz;
+        }
+        const float64 normalisation = 1.0 / static_cast<float64>(n - 1u);
+        covarianceOutput[0u] = xx * normalisation;
+        covarianceOutput[1u] = xy * normalisation;
+        covarianceOutput[2u] = xz * normalisation;
+        covarianceOutput[3u] = covarianceOutput[1u];
+        covarianceOutput[4u] = yy * normalisation;
+        covarianceOutput[5u] = yz * normalisation;
+        covarianceOutput[6u] = covarianceOutput[2u];
+        covarianceOutput[7u] = covarianceOutput[5u];
+        covarianceOutput[8u] = zz * normalisation;
+    }
+}
+
+bool LorenzEnKF::Execute() {
+    Forecast();
+    Analyse();
+    Publish();
+    return true;
+}
+
+CLASS_REGISTER(LorenzEnKF, "1.0")
+
+}
@@ -0,0 +1,248 @@
+/**
+ * @file LorenzEnKF.h
+ * @brief Header file for class LorenzEnKF
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This header file contains the declaration of the class
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LORENZENKF_H_
+#define LORENZENKF_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "GAM.h"
+#include "LorenzKernels.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief GAM which estimates the state of a Lorenz system from noisy measurements with an ensemble Kalman filter.
+ * @details At every cycle the ensemble is propagated by NumberOfSubSteps steps of the Lorenz model (forecast),
+ * using the same structure-of-arrays stage kernels as the LorenzAttractor, and then corrected with the
+ * measurements read from the input signals (analysis). The measurements are taken at the end of the forecast.
+ *
+ * The analysis is the serial ensemble square root filter (EnSRF, Whitaker and Hamill 2002): the measurements
+ * have independent errors and are assimilated one at a time, so that the gain is a 3 element vector and no
+ * matrix has to be inverted nor perturbed observations drawn. The filter is thus deterministic once the initial
+ * ensemble has been sampled. All the linear algebra is done on fixed size arrays; the only allocations
+ * (the ensemble buffers) happen in Setup. Optionally the forecast anomalies are multiplied by Inflation before
+ * the analysis to compensate for the sampling error of small ensembles.
+ *
+ * The initial ensemble is sampled in Setup from a Gaussian with the configured InitialMean and InitialSpread
+ * (standard deviation per component) using LorenzRandom(Seed), member by member and x, y, z for each member.
+ *
+ * The measured components are the input signals named X, Y and/or Z (at least one). The state estimate
+ * (ensemble mean) and the covariance of the analysis ensemble (row-major, unbiased) are written to the
+ * Estimate and (optional) Covariance output signals.
+ *
+ * The configuration syntax is (names and signal quantity are only given as an example):
+ *
+ * <pre>
+ * +Filter = {
+ *     Class = LorenzEnKF
+ *     TimeStep = 0.001 // Compulsory. Integration step in seconds.
+ *     NumberOfSubSteps = 10 // Optional. Default = 1.
+ *     Integrator = RK4 // Optional. RK4, Heun, Midpoint or Euler. Default = RK4.
+ *     Sigma = 10.0 // Optional.
+ *     Rho = 28.0 // Optional.
+ *     Beta = 2.6666666667 // Optional.
+ *     NumberOfMembers = 1000 // Compulsory. > 1.
+ *     Seed = 1 // Optional. Default = 1.
+ *     InitialMean = { 1.0 1.0 1.0 } // Optional. Default = { 1.0 1.0 1.0 }.
+ *     InitialSpread = { 1.0 1.0 1.0 } // Optional. Default = { 1.0 1.0 1.0 }.
+ *     MeasurementNoise = { 0.5 0.5 0.5 } // Compulsory. Standard deviation of the X, Y and Z measurements (> 0 if measured).
+ *     Inflation = 1.02 // Optional. >= 1. Default = 1.
+ *     InputSignals = {
+ *         X = { DataSource = DDB Type = float64 }
+ *         Z = { DataSource = DDB Type = float64 }
+ *     }
+ *     OutputSignals = {
+ *         Estimate = { DataSource = DDB Type = float64 NumberOfElements = 3 }
+ *         Covariance = { DataSource = DDB Type = float64 NumberOfElements = 9 } // Optional.
+ *     }
+ * }
+ * </pre>
+ */
+class LorenzEnKF: public GAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LorenzEnKF();
+
+    /**
+     * @brief Destructor. Frees the ensemble memory.
+     */
+    virtual ~LorenzEnKF();
+
+    /**
+     * @brief Reads the model and filter parameters.
+     * @return true if GAM::Initialise succeeds and the parameters are consistent.
+     * @pre
+     *   TimeStep > 0 && NumberOfSubSteps > 0 && NumberOfMembers > 1 &&
+     *   MeasurementNoise has 3 elements && Inflation >= 1
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Binds the measurements and the outputs and samples the initial ensemble.
+     * @return true if the pre-conditions are met.
+     * @pre
+     *   The input signals are a non-empty subset of X, Y, Z (float64, 1 element) with MeasurementNoise > 0 &&
+     *   Estimate is float64 with 3 elements && Covariance (if set) is float64 with 9 elements.
+     */
+    virtual bool Setup();
+
+    /**
+     * @brief Forecasts the ensemble, assimilates the measurements and publishes the estimate.
+     * @return true.
+     */
+    virtual bool Execute();
+
+private:
+
+    /**
+     * @brief Propagates all the members by NumberOfSubSteps steps.
+     */
+    void Forecast();
+
+    /**
+     * @brief Inflates the anomalies and assimilates the measurements one at a time.
+     */
+    void Analyse();
+
+    /**
+     * @brief Computes the ensemble mean.
+     */
+    void ComputeMean(float64 (&mean)[3]) const;
+
+    /**
+     * @brief Writes the ensemble mean and covariance to the outputs.
+     */
+    void Publish();
+
+    /**
+     * The model parameters.
+     */
+    LorenzKernels::Parameters<float64> parameters;
+
+    /**
+     * Integration step.
+     */
+    float64 timeStep;
+
+    /**
+     * Steps per cycle.
+     */
+    uint32 numberOfSubSteps;
+
+    /**
+     * The integration method.
+     */
+    LorenzKernels::Tableau tableau;
+
+    /**
+     * Number of ensemble members.
+     */
+    uint32 numberOfMembers;
+
+    /**
+     * Seed of the initial ensemble.
+     */
+    uint32 seed;
+
+    /**
+     * Mean of the initial ensemble.
+     */
+    float64 initialMean[3];
+
+    /**
+     * Standard deviation of the initial ensemble.
+     */
+    float64 initialSpread[3];
+
+    /**
+     * Standard deviation of the measurement errors.
+     */
+    float64 measurementNoise[3];
+
+    /**
+     * Multiplicative inflation of the forecast anomalies.
+     */
+    float64 inflation;
+
+    /**
+     * Measurement input signals (NULL if the component is not measured).
+     */
+    const float64 *measurements[3];
+
+    /**
+     * The ensemble (structure-of-arrays, stride = numberOfMembers).
+     */
+    float64 *state;
+
+    /**
+     * Stage buffers.
+     */
+    float64 *stageBuffer[2];
+
+    /**
+     * Runge-Kutta accumulator.
+     */
+    float64 *accumulator;
+
+    /**
+     * Arguments of the stage kernel.
+     */
+    LorenzKernels::StageArguments<float64> stageArguments;
+
+    /**
+     * Estimate output signal.
+     */
+    float64 *estimateOutput;
+
+    /**
+     * Covariance output signal (NULL if not configured).
+     */
+    float64 *covarianceOutput;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LORENZENKF_H_ */
@@ -25,6 +25,7 @@ export MARTe2_Components_DIR=~/Projects/MARTe2-components
 fi
 
 LD_LIBRARY_PATH=$LD_LIBRARY_PATH:../Build/x86-linux/As_models/GAMs/LorenzAttractor/
+LD_LIBRARY_PATH=$LD_LIBRARY_PATH:../Build/x86-linux/As_models/GAMs/LorenzEnKF/
 LD_LIBRARY_PATH=$LD_LIBRARY_PATH:$MARTe2_DIR/Build/x86-linux/Core/
 LD_LIBRARY_PATH=$LD_LIBRARY_PATH:$MARTe2_Components_DIR/Build/x86-linux/Components/DataSources/EPICSCA/
 LD_LIBRARY_PATH=$LD_LIBRARY_PATH:$MARTe2_Components_DIR/Build/x86-linux/Components/DataSources/EPICSPVA/
@@ -47,6 +47,91 @@ TEST(LorenzAttractorGTest,TestConstructor) {
     ASSERT_TRUE(test.TestConstructor());
 }
 
+TEST(LorenzAttractorGTest,TestExecute_Model) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestExecute_Model());
+}
+
+TEST(LorenzAttractorGTest,TestExecute_Coupled) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestExecute_Coupled());
+}
+
+TEST(LorenzAttractorGTest,TestInitialise_InvalidCoupling) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestInitialise_InvalidCoupling());
+}
+
+TEST(LorenzAttractorGTest,TestInitialise_LyapunovCoupled) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestInitialise_LyapunovCoupled());
+}
+
+TEST(LorenzAttractorGTest,TestExecute_Events) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestExecute_Events());
+}
+
+TEST(LorenzAttractorGTest,TestExecute_EventsOverflow) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestExecute_EventsOverflow());
+}
+
+TEST(LorenzAttractorGTest,TestReconfigure) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestReconfigure());
+}
+
+TEST(LorenzAttractorGTest,TestExecute_Lyapunov) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestExecute_Lyapunov());
+}
+
+TEST(LorenzAttractorGTest,TestSweep) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestSweep());
+}
+
+TEST(LorenzAttractorGTest,TestSweep_Cancel) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestSweep_Cancel());
+}
+
+TEST(LorenzAttractorGTest,TestInitialise_InvalidSweepCPUs) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestInitialise_InvalidSweepCPUs());
+}
+
+TEST(LorenzAttractorGTest,TestExecute_Precision) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestExecute_Precision());
+}
+
+TEST(LorenzAttractorGTest,TestSetOutput_Diagnostics) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestSetOutput_Diagnostics());
+}
+
+TEST(LorenzAttractorGTest,TestSetOutput_DiagnosticsArray) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestSetOutput_DiagnosticsArray());
+}
+
+TEST(LorenzAttractorGTest,TestExecute_NoPageFaults) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestExecute_NoPageFaults());
+}
+
+TEST(LorenzAttractorGTest,TestInitialConditions_File) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestInitialConditions_File());
+}
+
+TEST(LorenzAttractorGTest,TestInitialConditions_Generators) {
+    LorenzAttractorTest test;
+    ASSERT_TRUE(test.TestInitialConditions_Generators());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
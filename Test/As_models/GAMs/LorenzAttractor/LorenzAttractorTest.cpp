@@ -30,20 +30,30 @@
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
 
+#include <math.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "BasicFile.h"
 #include "ConfigurationDatabase.h"
 #include "ErrorInformation.h"
 #include "ErrorManagement.h"
 #include "FastMath.h"
 #include "GAM.h"
 #include "GlobalObjectsDatabase.h"
+#include "MemoryOperationsHelper.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
+#include "Sleep.h"
 #include "StandardParser.h"
+#include "StringHelper.h"
+#include "LorenzArrayFile.h"
 #include "LorenzAttractor.h"
 #include "LorenzAttractorTest.h"
 
@@ -58,6 +68,7 @@ public:
     LorenzAttractorHelper() : MARTe::LorenzAttractor() {};
     virtual ~LorenzAttractorHelper() {};
     template <typename Type> bool GetOutput (MARTe::uint32 index, Type& value, MARTe::uint32 offset = 0u);
+    using MARTe::LorenzAttractor::StopDiagnostics;
 };
 
 template<typename Type> bool LorenzAttractorHelper::GetOutput(MARTe::uint32 signalIndex, Type& value, MARTe::uint32 index) {
@@ -151,6 +162,25 @@ bool ConfigureApplication(const MARTe::char8 * const config) {
 
 }
 
+/**
+ * @brief Configures a $Test application whose single real-time thread executes the +LorenzAttractor GAM with the
+ * configuration \a gam (the body of the GAM block).
+ */
+bool ConfigureGAM(const MARTe::char8 * const gam) {
+    using namespace MARTe;
+    StreamString config;
+    bool ok = config.Printf("$Test = { Class = RealTimeApplication +Functions = { Class = ReferenceContainer +LorenzAttractor = { %s } }"
+                            " +Data = { Class = ReferenceContainer DefaultDataSource = DDB +DDB = { Class = GAMDataSource }"
+                            " +Timings = { Class = TimingDataSource } }"
+                            " +States = { Class = ReferenceContainer +Running = { Class = RealTimeState +Threads = {"
+                            " Class = ReferenceContainer +Thread = { Class = RealTimeThread Functions = { LorenzAttractor } } } } }"
+                            " +Scheduler = { Class = GAMScheduler TimingDataSource = Timings } }", gam);
+    if (ok) {
+        ok = ConfigureApplication(config.Buffer());
+    }
+    return ok;
+}
+
 static inline bool StartApplication(const MARTe::char8 * const state = "Running") {
 
     using namespace MARTe;
@@ -207,6 +237,315 @@ static inline bool StopApplication() {
 
 }
 
+static inline bool IsClose(const MARTe::float64 value, const MARTe::float64 expected, const MARTe::float64 tolerance) {
+    MARTe::float64 difference = value - expected;
+    return ((difference < tolerance) && (difference > -tolerance));
+}
+
+/**
+ * Reference (dense, unordered) RK4 integration of N diffusively coupled Lorenz nodes.
+ */
+static void ReferenceStep(MARTe::float64 * const x, MARTe::float64 * const y, MARTe::float64 * const z, const MARTe::uint32 n,
+                          const MARTe::float64 * const adjacency, const MARTe::float64 strength, const MARTe::float64 h) {
+    using namespace MARTe;
+    const float64 sigma = 10.0;
+    const float64 rho = 28.0;
+    const float64 beta = 8.0 / 3.0;
+    float64 k[4][3][8];
+    float64 s[3][8];
+    const float64 c[4] = { 0.0, 0.5, 0.5, 1.0 };
+    uint32 stage;
+    for (stage = 0u; stage < 4u; stage++) {
+        uint32 i;
+        for (i = 0u; i < n; i++) {
+            s[0][i] = x[i] + ((stage > 0u) ? (c[stage] * h * k[stage - 1u][0][i]) : (0.0));
+            s[1][i] = y[i] + ((stage > 0u) ? (c[stage] * h * k[stage - 1u][1][i]) : (0.0));
+            s[2][i] = z[i] + ((stage > 0u) ? (c[stage] * h * k[stage - 1u][2][i]) : (0.0));
+        }
+        for (i = 0u; i < n; i++) {
+            float64 coupling = 0.0;
+            uint32 j;
+            for (j = 0u; j < n; j++) {
+                coupling += adjacency[(i * n) + j] * (s[0][j] - s[0][i]);
+            }
+            k[stage][0][i] = (sigma * (s[1][i] - s[0][i])) + (strength * coupling);
+            k[stage][1][i] = (s[0][i] * (rho - s[2][i])) - s[1][i];
+            k[stage][2][i] = (s[0][i] * s[1][i]) - (beta * s[2][i]);
+        }
+    }
+    uint32 i;
+    for (i = 0u; i < n; i++) {
+        x[i] += (h / 6.0) * (k[0][0][i] + (2.0 * k[1][0][i]) + (2.0 * k[2][0][i]) + k[3][0][i]);
+        y[i] += (h / 6.0) * (k[0][1][i] + (2.0 * k[1][1][i]) + (2.0 * k[2][1][i]) + k[3][1][i]);
+        z[i] += (h / 6.0) * (k[0][2][i] + (2.0 * k[1][2][i]) + (2.0 * k[2][2][i]) + k[3][2][i]);
+    }
+}
+
+/**
+ * Runs the Functions.LorenzAttractor GAM for numberOfCycles and compares X, Y and Z with the reference.
+ */
+static bool CompareWithReference(const MARTe::uint32 n, MARTe::float64 * const x, MARTe::float64 * const y, MARTe::float64 * const z,
+                                 const MARTe::float64 * const adjacency, const MARTe::float64 strength, const MARTe::float64 h,
+                                 const MARTe::uint32 numberOfSubSteps, const MARTe::uint32 numberOfCycles) {
+    using namespace MARTe;
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    bool ok = gam.IsValid();
+    uint32 cycle;
+    for (cycle = 0u; (cycle < numberOfCycles) && (ok); cycle++) {
+        ok = gam->Execute();
+        uint32 s;
+        for (s = 0u; s < numberOfSubSteps; s++) {
+            ReferenceStep(x, y, z, n, adjacency, strength, h);
+        }
+        uint32 i;
+        for (i = 0u; (i < n) && (ok); i++) {
+            float64 value[3];
+            ok = (gam->GetOutput(0u, value[0], i) && gam->GetOutput(1u, value[1], i) && gam->GetOutput(2u, value[2], i));
+            if (ok) {
+                ok = (IsClose(value[0], x[i], 1e-9) && IsClose(value[1], y[i], 1e-9) && IsClose(value[2], z[i], 1e-9));
+            }
+        }
+    }
+    return ok;
+}
+
+/**
+ * GAM with a single node and the sweep signals (SweepProgress is signal 3, SweepState signal 4).
+ */
+const MARTe::char8 * const sweepConfig = ""
+  "    Class = LorenzAttractorHelper"
+  "    TimeStep = 0.01"
+  "    SweepCPUs = 0x1"
+  "    RealTimeCPUs = 0x2"
+  "    OutputSignals = {"
+  "        X = {"
+  "            DataSource = DDB"
+  "            Type = float64"
+  "            Default = 1.0"
+  "        }"
+  "        Y = {"
+  "            DataSource = DDB"
+  "            Type = float64"
+  "            Default = 1.0"
+  "        }"
+  "        Z = {"
+  "            DataSource = DDB"
+  "            Type = float64"
+  "            Default = 1.0"
+  "        }"
+  "        SweepProgress = {"
+  "            DataSource = DDB"
+  "            Type = uint32"
+  "        }"
+  "        SweepState = {"
+  "            DataSource = DDB"
+  "            Type = uint32"
+  "        }"
+  "    }";
+
+/**
+ * @brief Sends a Sweep message over rho in [10, 28] with the given number of points.
+ */
+MARTe::ErrorManagement::ErrorType StartSweep(MARTe::ReferenceT<LorenzAttractorHelper> gam, const MARTe::uint32 points, const MARTe::char8 * const fileName) {
+    using namespace MARTe;
+    ReferenceT<ConfigurationDatabase> parameters(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceContainer message;
+    bool ok = parameters->CreateRelative("Rho");
+    if (ok) {
+        ok = (parameters->Write("From", 10.0) && parameters->Write("To", 28.0) && parameters->Write("Points", points));
+    }
+    if (ok) {
+        ok = parameters->MoveToAncestor(1u);
+    }
+    if (ok) {
+        ok = (parameters->Write("TransientTime", 10.0) && parameters->Write("MeasurementTime", 40.0) && parameters->Write("File", fileName));
+    }
+    if (ok) {
+        ok = message.Insert(parameters);
+    }
+    ErrorManagement::ErrorType ret = ErrorManagement::ParametersError;
+    if (ok) {
+        ret = gam->Sweep(message);
+    }
+    return ret;
+}
+
+/**
+ * @brief Executes the GAM until the SweepState is no longer Running (or about 10 s elapsed).
+ */
+bool WaitForSweep(MARTe::ReferenceT<LorenzAttractorHelper> gam, MARTe::uint32 &state, MARTe::uint32 &progress) {
+    using namespace MARTe;
+    bool ok = true;
+    state = static_cast<uint32>(LorenzSweep::Running);
+    uint32 tries;
+    for (tries = 0u; (tries < 10000u) && (ok) && (state == static_cast<uint32>(LorenzSweep::Running)); tries++) {
+        Sleep::MSec(1);
+        ok = (gam->Execute() && gam->GetOutput(3u, progress) && gam->GetOutput(4u, state));
+    }
+    return ok;
+}
+
+/**
+ * @brief Integrates numberOfNodes uncoupled nodes with the given Precision for numberOfCycles cycles of 10 steps of 1 ms
+ * and returns the final X, Y and Z of every node in \a state (3 x numberOfNodes).
+ */
+bool IntegratePrecision(const MARTe::char8 * const precision, const MARTe::uint32 numberOfNodes, const MARTe::uint32 numberOfCycles,
+                        MARTe::float64 * const state) {
+    using namespace MARTe;
+    StreamString config;
+    bool ok = config.Printf("%s", "Class = LorenzAttractorHelper TimeStep = 0.001 NumberOfSubSteps = 10 Precision = ");
+    ok = (ok) && (config.Printf("%s OutputSignals = {", precision));
+    const char8 * const names[3] = { "X", "Y", "Z" };
+    uint32 c;
+    for (c = 0u; (c < 3u) && (ok); c++) {
+        ok = config.Printf(" %s = { DataSource = DDB Type = float64 NumberOfElements = %u Default = {", names[c], numberOfNodes);
+        uint32 i;
+        for (i = 0u; (i < numberOfNodes) && (ok); i++) {
+            // Nearby initial conditions, so that the nodes sample different trajectories on the attractor
+            const float64 value = (c == 0u) ? (1.0 + (0.001 * static_cast<float64>(i))) : (1.0);
+            ok = config.Printf(" %f", value);
+        }
+        ok = (ok) && (config.Printf("%s", " } }"));
+    }
+    ok = (ok) && (config.Printf("%s", " }"));
+    if (ok) {
+        ok = ConfigureGAM(config.Buffer());
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    uint32 cycle;
+    for (cycle = 0u; (cycle < numberOfCycles) && (ok); cycle++) {
+        ok = gam->Execute();
+    }
+    for (c = 0u; (c < 3u) && (ok); c++) {
+        uint32 i;
+        for (i = 0u; (i < numberOfNodes) && (ok); i++) {
+            ok = gam->GetOutput(c, state[(c * numberOfNodes) + i], i);
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+/**
+ * @brief Number of reports containing "new value", "repeated" and "rate limit" (see CountReports).
+ */
+volatile MARTe::int32 newValueReports = 0;
+volatile MARTe::int32 repeatedReports = 0;
+volatile MARTe::int32 rateLimitReports = 0;
+
+/**
+ * @brief Number of Setup reports ("has type" and "has value") and number of records reported as repeated,
+ * suppressed by the rate limit and dropped (see CountReports).
+ */
+volatile MARTe::int32 setupReports = 0;
+volatile MARTe::int32 repeatedRecords = 0;
+volatile MARTe::int32 rateLimitedRecords = 0;
+volatile MARTe::int32 droppedRecords = 0;
+
+/**
+ * @brief Reads the unsigned integer at the beginning of \a text.
+ */
+MARTe::int32 ReadCount(const MARTe::char8 *text) {
+    MARTe::int32 count = 0;
+    while ((*text >= '0') && (*text <= '9')) {
+        count = (count * 10) + static_cast<MARTe::int32>(*text - '0');
+        text++;
+    }
+    return count;
+}
+
+/**
+ * @brief ErrorProcessFunction which counts the diagnostics reports of SetOutput.
+ */
+void CountReports(const MARTe::ErrorManagement::ErrorInformation &/*errorInfo*/, const MARTe::char8 * const errorDescription) {
+    using namespace MARTe;
+    if (StringHelper::SearchString(errorDescription, "new value") != NULL_PTR(const char8 *)) {
+        Atomic::Increment(&newValueReports);
+    }
+    if ((StringHelper::SearchString(errorDescription, "has type") != NULL_PTR(const char8 *))
+            || (StringHelper::SearchString(errorDescription, "has value") != NULL_PTR(const char8 *))) {
+        Atomic::Increment(&setupReports);
+    }
+    const char8 * const repeated = StringHelper::SearchString(errorDescription, "repeated ");
+    if (repeated != NULL_PTR(const char8 *)) {
+        Atomic::Increment(&repeatedReports);
+        repeatedRecords += ReadCount(&repeated[9]);
+    }
+    if (StringHelper::SearchString(errorDescription, "rate limit") != NULL_PTR(const char8 *)) {
+        Atomic::Increment(&rateLimitReports);
+        rateLimitedRecords += ReadCount(errorDescription);
+    }
+    if (StringHelper::SearchString(errorDescription, "dropped") != NULL_PTR(const char8 *)) {
+        droppedRecords += ReadCount(errorDescription);
+    }
+}
+
+/**
+ * @brief Sends a SetOutput message with the given SignalIndex and SignalValue.
+ */
+template<typename Type>
+MARTe::ErrorManagement::ErrorType SetOutput(MARTe::ReferenceT<LorenzAttractorHelper> gam, const MARTe::uint32 signalIndex, Type &value) {
+    using namespace MARTe;
+    ReferenceT<ConfigurationDatabase> parameters(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceContainer message;
+    bool ok = (parameters->Write("SignalIndex", signalIndex) && parameters->Write("SignalValue", value));
+    if (ok) {
+        ok = message.Insert(parameters);
+    }
+    ErrorManagement::ErrorType ret = ErrorManagement::ParametersError;
+    if (ok) {
+        ret = gam->SetOutput(message);
+    }
+    return ret;
+}
+
+/**
+ * @brief Configures a GAM with numberOfNodes uncoupled nodes, the given InitialConditions block and X, Y and Z without Default.
+ */
+bool ConfigureInitialConditions(const MARTe::char8 * const initialConditions, const MARTe::uint32 numberOfNodes) {
+    using namespace MARTe;
+    StreamString config;
+    bool ok = config.Printf("%s", "Class = LorenzAttractorHelper TimeStep = 0.01 NumberOfSubSteps = 10 InitialConditions = {");
+    ok = (ok) && (config.Printf("%s } OutputSignals = {", initialConditions));
+    const char8 * const names[3] = { "X", "Y", "Z" };
+    uint32 c;
+    for (c = 0u; (c < 3u) && (ok); c++) {
+        ok = config.Printf(" %s = { DataSource = DDB Type = float64 NumberOfElements = %u }", names[c], numberOfNodes);
+    }
+    ok = (ok) && (config.Printf("%s", " }"));
+    if (ok) {
+        ok = ConfigureGAM(config.Buffer());
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the mean and the standard deviation of the first numberOfNodes elements of the output signal \a signalIndex,
+ * and checks that they are in [minimum, maximum].
+ */
+bool GetStatistics(MARTe::ReferenceT<LorenzAttractorHelper> gam, const MARTe::uint32 signalIndex, const MARTe::uint32 numberOfNodes,
+                   const MARTe::float64 minimum, const MARTe::float64 maximum, MARTe::float64 &mean, MARTe::float64 &deviation) {
+    using namespace MARTe;
+    bool ok = true;
+    float64 sum = 0.0;
+    float64 sumOfSquares = 0.0;
+    uint32 i;
+    for (i = 0u; (i < numberOfNodes) && (ok); i++) {
+        float64 value = 0.0;
+        ok = (gam->GetOutput(signalIndex, value, i) && (value >= minimum) && (value <= maximum));
+        sum += value;
+        sumOfSquares += value * value;
+    }
+    mean = sum / static_cast<float64>(numberOfNodes);
+    deviation = sqrt((sumOfSquares / static_cast<float64>(numberOfNodes)) - (mean * mean));
+    return ok;
+}
+
 } /* namespace LorenzAttractorTestHelper */
 
 /*---------------------------------------------------------------------------*/
@@ -295,12 +634,935 @@ bool LorenzAttractorTest::TestSetup() {
     
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
     ReferenceT<RealTimeApplication> application = god->Find("Test");
-    ReferenceT<LorenzAttractor> gam = application->Find("Functions.LorenzAttractor");
+    ReferenceT<LorenzAttractor> gam;
+
+    if (ok) {
+        ok = application.IsValid();
+    }
+
+    if (ok) {
+        gam = application->Find("Functions.LorenzAttractor");
+        ok = gam.IsValid();
+    }
+
+    return ok;
+}
+
+
+bool LorenzAttractorTest::TestExecute_Model() {
+    const MARTe::char8 * const config = ""
+      "    Class = LorenzAttractorHelper"
+      "    TimeStep = 0.001"
+      "    NumberOfSubSteps = 10"
+      "    OutputSignals = {"
+      "        X = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 2"
+      "            Default = {1.0 -1.0}"
+      "        }"
+      "        Y = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 2"
+      "            Default = {1.0 2.0}"
+      "        }"
+      "        Z = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 2"
+      "            Default = {1.0 20.0}"
+      "        }"
+      "    }";
+
+    bool ok = LorenzAttractorTestHelper::ConfigureGAM(config);
+
+    using namespace MARTe;
+    float64 x[2] = { 1.0, -1.0 };
+    float64 y[2] = { 1.0, 2.0 };
+    float64 z[2] = { 1.0, 20.0 };
+    float64 adjacency[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+    if (ok) {
+        ok = LorenzAttractorTestHelper::CompareWithReference(2u, x, y, z, adjacency, 0.0, 0.001, 10u, 20u);
+    }
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool LorenzAttractorTest::TestExecute_Coupled() {
+    const MARTe::char8 * const config = ""
+      "    Class = LorenzAttractorHelper"
+      "    TimeStep = 0.001"
+      "    NumberOfSubSteps = 5"
+      "    NumberOfWorkers = 2"
+      "    Coupling = {"
+      "        Strength = 2.0"
+      "        Rows = {0 1 2 3 4 0 2}"
+      "        Columns = {3 4 0 1 2 2 0}"
+      "        Weights = {1.0 0.5 1.0 2.0 1.0 0.25 0.25}"
+      "        Reordering = RCM"
+      "    }"
+      "    OutputSignals = {"
+      "        X = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 5"
+      "            Default = {1.0 -1.0 2.0 -2.0 3.0}"
+      "        }"
+      "        Y = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 5"
+      "            Default = {1.0 2.0 3.0 4.0 5.0}"
+      "        }"
+      "        Z = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 5"
+      "            Default = {20.0 21.0 22.0 23.0 24.0}"
+      "        }"
+      "    }";
+
+    bool ok = LorenzAttractorTestHelper::ConfigureGAM(config);
+
+    using namespace MARTe;
+    float64 x[5] = { 1.0, -1.0, 2.0, -2.0, 3.0 };
+    float64 y[5] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+    float64 z[5] = { 20.0, 21.0, 22.0, 23.0, 24.0 };
+    float64 adjacency[25];
+    uint32 i;
+    for (i = 0u; i < 25u; i++) {
+        adjacency[i] = 0.0;
+    }
+    adjacency[(0u * 5u) + 3u] = 1.0;
+    adjacency[(1u * 5u) + 4u] = 0.5;
+    adjacency[(2u * 5u) + 0u] = 1.0;
+    adjacency[(3u * 5u) + 1u] = 2.0;
+    adjacency[(4u * 5u) + 2u] = 1.0;
+    adjacency[(0u * 5u) + 2u] = 0.25;
+    adjacency[(2u * 5u) + 0u] += 0.25;
+
+    if (ok) {
+        ok = LorenzAttractorTestHelper::CompareWithReference(5u, x, y, z, adjacency, 2.0, 0.001, 5u, 20u);
+    }
+
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool LorenzAttractorTest::TestInitialise_InvalidCoupling() {
+    using namespace MARTe;
+    LorenzAttractor gam;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("TimeStep", 0.001);
+    if (ok) {
+        ok = cdb.CreateRelative("Coupling");
+    }
+    if (ok) {
+        uint32 rows[2] = { 0u, 1u };
+        uint32 columns[3] = { 1u, 0u, 1u };
+        ok = (cdb.Write("Strength", 1.0) && cdb.Write("Rows", rows) && cdb.Write("Columns", columns));
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = !gam.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool LorenzAttractorTest::TestInitialise_LyapunovCoupled() {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 withLyapunov;
+    for (withLyapunov = 0u; (withLyapunov < 2u) && (ok); withLyapunov++) {
+        LorenzAttractor gam;
+        ConfigurationDatabase cdb;
+        ok = (cdb.Write("TimeStep", 0.001) && cdb.CreateRelative("Coupling"));
+        if (ok) {
+            uint32 rows[2] = { 0u, 1u };
+            uint32 columns[2] = { 1u, 0u };
+            ok = (cdb.Write("Strength", 1.0) && cdb.Write("Rows", rows) && cdb.Write("Columns", columns) && cdb.MoveToRoot());
+        }
+        if ((ok) && (withLyapunov == 1u)) {
+            ok = (cdb.CreateRelative("Lyapunov") && cdb.Write("TimeConstant", 1.0) && cdb.MoveToRoot());
+        }
+        if (ok) {
+            // The same network is accepted without the estimator
+            ok = (gam.Initialise(cdb) == (withLyapunov == 0u));
+        }
+    }
+    return ok;
+}
+
+bool LorenzAttractorTest::TestExecute_Events() {
+    const MARTe::char8 * const config = ""
+      "    Class = LorenzAttractorHelper"
+      "    TimeStep = 0.01"
+      "    NumberOfSubSteps = 10"
+      "    Events = {"
+      "        LobeSwitches = 1"
+      "        Planes = {"
+      "            Poincare = {"
+      "                Normal = {0.0 0.0 1.0}"
+      "                Offset = 27.0"
+      "            }"
+      "        }"
+      "    }"
+      "    OutputSignals = {"
+      "        X = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            Default = 1.0"
+      "        }"
+      "        Y = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            Default = 1.0"
+      "        }"
+      "        Z = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            Default = 1.0"
+      "        }"
+      "        Time = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "        }"
+      "        EventCount = {"
+      "            DataSource = DDB"
+      "            Type = uint32"
+      "        }"
+      "        EventTimes = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 4"
+      "        }"
+      "        EventNodes = {"
+      "            DataSource = DDB"
+      "            Type = uint32"
+      "            NumberOfElements = 4"
+      "        }"
+      "        EventTypes = {"
+      "            DataSource = DDB"
+      "            Type = int32"
+      "            NumberOfElements = 4"
+      "        }"
+      "    }";
+
+    bool ok = LorenzAttractorTestHelper::ConfigureGAM(config);
+
+    using namespace MARTe;
+    // Crossings of the trajectory starting at (1, 1, 1), computed with a 1e-6 s step
+    const float64 expectedTimes[4] = { 0.302058462, 0.512724238, 0.590343787, 0.858979626 };
+    const int32 expectedTypes[4] = { 2, -1, -2, 2 };
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    uint32 numberOfEvents = 0u;
+    uint32 cycle;
+    for (cycle = 0u; (cycle < 10u) && (ok); cycle++) {
+        ok = gam->Execute();
+        uint32 eventCount = 0u;
+        if (ok) {
+            ok = gam->GetOutput(4u, eventCount);
+        }
+        if (ok) {
+            ok = ((numberOfEvents + eventCount) <= 4u);
+        }
+        uint32 e;
+        for (e = 0u; (e < eventCount) && (ok); e++) {
+            float64 eventTime = 0.0;
+            uint32 eventNode = 1u;
+            int32 eventType = 0;
+            ok = (gam->GetOutput(5u, eventTime, e) && gam->GetOutput(6u, eventNode, e) && gam->GetOutput(7u, eventType, e));
+            if (ok) {
+                ok = (LorenzAttractorTestHelper::IsClose(eventTime, expectedTimes[numberOfEvents], 1e-4) && (eventNode == 0u)
+                        && (eventType == expectedTypes[numberOfEvents]));
+            }
+            numberOfEvents++;
+        }
+    }
+    if (ok) {
+        ok = (numberOfEvents == 4u);
+    }
+    float64 modelTime = 0.0;
+    if (ok) {
+        ok = gam->GetOutput(3u, modelTime);
+    }
+    if (ok) {
+        ok = LorenzAttractorTestHelper::IsClose(modelTime, 1.0, 1e-9);
+    }
+
+    god->Purge();
+    return ok;
+}
+
+bool LorenzAttractorTest::TestExecute_EventsOverflow() {
+    const MARTe::char8 * const config = ""
+      "    Class = LorenzAttractorHelper"
+      "    TimeStep = 0.01"
+      "    NumberOfSubSteps = 10"
+      "    Events = {"
+      "        LobeSwitches = 0"
+      "        Planes = {"
+      "            Poincare = {"
+      "                Normal = {0.0 0.0 1.0}"
+      "                Offset = 27.0"
+      "            }"
+      "        }"
+      "    }"
+      "    OutputSignals = {"
+      "        X = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 2"
+      "            Default = {0.95 1.0}"
+      "        }"
+      "        Y = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 2"
+      "            Default = {1.0 1.0}"
+      "        }"
+      "        Z = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 2"
+      "            Default = {1.0 1.0}"
+      "        }"
+      "        EventCount = {"
+      "            DataSource = DDB"
+      "            Type = uint32"
+      "        }"
+      "        EventTimes = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "        }"
+      "        EventNodes = {"
+      "            DataSource = DDB"
+      "            Type = uint32"
+      "        }"
+      "        EventTypes = {"
+      "            DataSource = DDB"
+      "            Type = int32"
+      "        }"
+      "    }";
+
+    bool ok = LorenzAttractorTestHelper::ConfigureGAM(config);
+
+    using namespace MARTe;
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    // Both nodes first cross z = 27 in the step [0.30, 0.31): node 0 at t = 0.304481, node 1 at t = 0.302058 (1e-5 s step)
+    uint32 cycle;
+    for (cycle = 0u; (cycle < 4u) && (ok); cycle++) {
+        ok = gam->Execute();
+        uint32 eventCount = 0u;
+        if (ok) {
+            ok = gam->GetOutput(3u, eventCount);
+        }
+        if (ok) {
+            ok = (eventCount == ((cycle == 3u) ? (2u) : (0u)));
+        }
+    }
+    // Only one event can be published: the earliest, although node 0 is scanned first
+    float64 eventTime = 0.0;
+    uint32 eventNode = 0u;
+    int32 eventType = 0;
+    if (ok) {
+        ok = (gam->GetOutput(4u, eventTime) && gam->GetOutput(5u, eventNode) && gam->GetOutput(6u, eventType));
+    }
+    if (ok) {
+        ok = (LorenzAttractorTestHelper::IsClose(eventTime, 0.302058462, 1e-4) && (eventNode == 1u) && (eventType == 2));
+    }
 
+    god->Purge();
+    return ok;
+}
+
+bool LorenzAttractorTest::TestReconfigure() {
+    const MARTe::char8 * const config = ""
+      "    Class = LorenzAttractorHelper"
+      "    TimeStep = 0.001"
+      "    NumberOfSubSteps = 10"
+      "    Integrator = Euler"
+      "    NumberOfNodes = 2"
+      "    OutputSignals = {"
+      "        X = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 4"
+      "            Default = {1.0 -1.0 2.0 -2.0}"
+      "        }"
+      "        Y = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 4"
+      "            Default = {1.0 2.0 3.0 4.0}"
+      "        }"
+      "        Z = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 4"
+      "            Default = {20.0 21.0 22.0 23.0}"
+      "        }"
+      "        NumberOfNodes = {"
+      "            DataSource = DDB"
+      "            Type = uint32"
+      "        }"
+      "    }";
+
+    bool ok = LorenzAttractorTestHelper::ConfigureGAM(config);
+
+    using namespace MARTe;
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
     if (ok) {
         ok = gam.IsValid();
     }
+    uint32 cycle;
+    for (cycle = 0u; (cycle < 3u) && (ok); cycle++) {
+        ok = gam->Execute();
+    }
 
+    ReferenceT<ConfigurationDatabase> parameters(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceContainer message;
+    if (ok) {
+        ok = (parameters->Write("NumberOfNodes", 4u) && parameters->Write("Integrator", "RK4") && parameters->Write("NumberOfSubSteps", 5u)
+                && parameters->Write("Commit", "StateChange"));
+    }
+    if (ok) {
+        ok = message.Insert(parameters);
+    }
+    if (ok) {
+        ok = (gam->Reconfigure(message) == ErrorManagement::NoError);
+    }
+    // Not committed before the state change
+    uint32 numberOfNodes = 0u;
+    if (ok) {
+        ok = gam->Execute();
+    }
+    if (ok) {
+        ok = (gam->GetOutput(3u, numberOfNodes) && (numberOfNodes == 2u));
+    }
+    float64 x[4] = { 0.0, 0.0, 2.0, -2.0 };
+    float64 y[4] = { 0.0, 0.0, 3.0, 4.0 };
+    float64 z[4] = { 0.0, 0.0, 22.0, 23.0 };
+    uint32 i;
+    for (i = 0u; (i < 2u) && (ok); i++) {
+        ok = (gam->GetOutput(0u, x[i], i) && gam->GetOutput(1u, y[i], i) && gam->GetOutput(2u, z[i], i));
+    }
+    if (ok) {
+        ok = gam->PrepareNextState("Running", "Running");
+    }
+    // The activated nodes restart from their Default values and all the nodes are integrated with RK4
+    float64 adjacency[16];
+    for (i = 0u; i < 16u; i++) {
+        adjacency[i] = 0.0;
+    }
+    if (ok) {
+        ok = LorenzAttractorTestHelper::CompareWithReference(4u, x, y, z, adjacency, 0.0, 0.001, 5u, 10u);
+    }
+    if (ok) {
+        ok = (gam->GetOutput(3u, numberOfNodes) && (numberOfNodes == 4u));
+    }
+    // Invalid requests are rejected
+    ReferenceT<ConfigurationDatabase> invalidParameters(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ReferenceContainer invalidMessage;
+    if (ok) {
+        ok = (invalidParameters->Write("NumberOfNodes", 5u) && invalidMessage.Insert(invalidParameters));
+    }
+    if (ok) {
+        ok = (gam->Reconfigure(invalidMessage) == ErrorManagement::ParametersError);
+    }
+
+    god->Purge();
     return ok;
 }
 
+bool LorenzAttractorTest::TestExecute_Lyapunov() {
+    const MARTe::char8 * const config = ""
+      "    Class = LorenzAttractorHelper"
+      "    TimeStep = 0.01"
+      "    NumberOfSubSteps = 10"
+      "    NumberOfWorkers = 1"
+      "    Lyapunov = {"
+      "    }"
+      "    OutputSignals = {"
+      "        X = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 2"
+      "            Default = {1.0 -1.0}"
+      "        }"
+      "        Y = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 2"
+      "            Default = {1.0 2.0}"
+      "        }"
+      "        Z = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 2"
+      "            Default = {1.0 20.0}"
+      "        }"
+      "        Lyapunov = {"
+      "            DataSource = DDB"
+      "            Type = float64"
+      "            NumberOfElements = 2"
+      "        }"
+      "    }";
+
+    bool ok = LorenzAttractorTestHelper::ConfigureGAM(config);
+
+    using namespace MARTe;
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    // 500 s of model time
+    uint32 cycle;
+    for (cycle = 0u; (cycle < 5000u) && (ok); cycle++) {
+        ok = gam->Execute();
+    }
+    // The largest Lyapunov exponent of the classical Lorenz system is ~0.906
+    uint32 n;
+    for (n = 0u; (n < 2u) && (ok); n++) {
+        float64 exponent = 0.0;
+        ok = gam->GetOutput(3u, exponent, n);
+        if (ok) {
+            ok = LorenzAttractorTestHelper::IsClose(exponent, 0.906, 0.06);
+        }
+    }
+
+    god->Purge();
+    return ok;
+}
+
+bool LorenzAttractorTest::TestSweep() {
+    using namespace MARTe;
+    const char8 * const fileName = "/tmp/LorenzAttractorSweepTest.bin";
+    bool ok = LorenzAttractorTestHelper::ConfigureGAM(LorenzAttractorTestHelper::sweepConfig);
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = (LorenzAttractorTestHelper::StartSweep(gam, 4u, fileName) == ErrorManagement::NoError);
+    }
+    // A second sweep is refused while the first one runs
+    if (ok) {
+        ok = (LorenzAttractorTestHelper::StartSweep(gam, 4u, fileName) != ErrorManagement::NoError);
+    }
+    uint32 state = 0u;
+    uint32 progress = 0u;
+    if (ok) {
+        ok = LorenzAttractorTestHelper::WaitForSweep(gam, state, progress);
+    }
+    if (ok) {
+        ok = ((state == static_cast<uint32>(LorenzSweep::Completed)) && (progress == 4u));
+    }
+
+    // Header, 13 descriptors and the arrays (12 float64 and one uint32, padded)
+    const uint32 descriptorsSize = static_cast<uint32>(sizeof(LorenzArrayFile::Header) + (13u * sizeof(LorenzArrayFile::FieldDescriptor)));
+    const uint32 fileSize = descriptorsSize + (12u * 32u) + 16u;
+    char8 buffer[1024];
+    BasicFile file;
+    if (ok) {
+        ok = file.Open(fileName, BasicFile::ACCESS_MODE_R);
+    }
+    if (ok) {
+        uint32 size = sizeof(buffer);
+        ok = (file.Read(&buffer[0], size) && (size == fileSize));
+        (void) file.Close();
+    }
+    LorenzArrayFile::Header header;
+    if (ok) {
+        (void) MemoryOperationsHelper::Copy(&header, &buffer[0], static_cast<uint32>(sizeof(header)));
+        ok = ((header.magic[0] == 'L') && (header.magic[3] == 'F') && (header.numberOfRecords == 4u) && (header.numberOfFields == 13u));
+    }
+    float64 rho[4];
+    float64 lyapunov[4];
+    uint32 hits[4];
+    if (ok) {
+        (void) MemoryOperationsHelper::Copy(&rho[0], &buffer[descriptorsSize + 32u], 32u);
+        (void) MemoryOperationsHelper::Copy(&lyapunov[0], &buffer[descriptorsSize + (11u * 32u)], 32u);
+        (void) MemoryOperationsHelper::Copy(&hits[0], &buffer[descriptorsSize + (12u * 32u)], 16u);
+        ok = ((rho[0] == 10.0) && (rho[3] == 28.0));
+    }
+    // Stable fixed point at rho = 10, chaos at rho = 28
+    if (ok) {
+        ok = ((lyapunov[0] < -0.3) && (lyapunov[3] > 0.6) && (hits[3] > 10u));
+    }
+
+    god->Purge();
+    return ok;
+}
+
+bool LorenzAttractorTest::TestSweep_Cancel() {
+    using namespace MARTe;
+    bool ok = LorenzAttractorTestHelper::ConfigureGAM(LorenzAttractorTestHelper::sweepConfig);
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = (LorenzAttractorTestHelper::StartSweep(gam, 100000u, "/tmp/LorenzAttractorSweepCancelTest.bin") == ErrorManagement::NoError);
+    }
+    ReferenceContainer message;
+    if (ok) {
+        ok = (gam->CancelSweep(message) == ErrorManagement::NoError);
+    }
+    uint32 state = 0u;
+    uint32 progress = 0u;
+    if (ok) {
+        ok = LorenzAttractorTestHelper::WaitForSweep(gam, state, progress);
+    }
+    if (ok) {
+        ok = ((state == static_cast<uint32>(LorenzSweep::Cancelled)) && (progress < 100000u));
+    }
+
+    god->Purge();
+    return ok;
+}
+
+bool LorenzAttractorTest::TestInitialise_InvalidSweepCPUs() {
+    using namespace MARTe;
+    // {NumberOfWorkers, WorkerCPUs, RealTimeCPUs, SweepCPUs, valid}
+    const uint32 cases[][5] = { { 1u, 0x2u, 0x1u, 0x4u, 1u }, { 0u, 0x0u, 0x1u, 0x4u, 1u }, { 0u, 0x0u, 0x0u, 0x4u, 0u }, { 1u, 0x0u, 0x1u, 0x4u, 0u },
+            { 1u, 0x2u, 0x1u, 0x1u, 0u }, { 1u, 0x2u, 0x1u, 0x6u, 0u } };
+    bool ok = true;
+    uint32 c;
+    for (c = 0u; (c < (sizeof(cases) / sizeof(cases[0]))) && (ok); c++) {
+        LorenzAttractor gam;
+        ConfigurationDatabase cdb;
+        ok = (cdb.Write("TimeStep", 0.001) && cdb.Write("NumberOfWorkers", cases[c][0]) && cdb.Write("WorkerCPUs", cases[c][1])
+                && cdb.Write("RealTimeCPUs", cases[c][2]) && cdb.Write("SweepCPUs", cases[c][3]));
+        if (ok) {
+            ok = (gam.Initialise(cdb) == (cases[c][4] != 0u));
+        }
+    }
+    return ok;
+}
+
+bool LorenzAttractorTest::TestExecute_Precision() {
+    using namespace MARTe;
+    // 1 s of integration: short enough for the rounding errors not to be amplified by the chaotic dynamics
+    const uint32 numberOfNodes = 16u;
+    const uint32 numberOfCycles = 100u;
+    const char8 * const precisions[3] = { "Float64", "Float32", "Float32Compensated" };
+    // Largest deviation from the Float64 state (about 3e-5 and 3e-6 expected)
+    const float64 bounds[3] = { 0.0, 1e-4, 1e-5 };
+    float64 *state[3];
+    bool ok = true;
+    uint32 p;
+    for (p = 0u; p < 3u; p++) {
+        state[p] = new float64[3u * numberOfNodes];
+    }
+    for (p = 0u; (p < 3u) && (ok); p++) {
+        ok = LorenzAttractorTestHelper::IntegratePrecision(precisions[p], numberOfNodes, numberOfCycles, state[p]);
+    }
+    for (p = 1u; (p < 3u) && (ok); p++) {
+        uint32 k;
+        for (k = 0u; (k < (3u * numberOfNodes)) && (ok); k++) {
+            ok = LorenzAttractorTestHelper::IsClose(state[p][k], state[0][k], bounds[p]);
+        }
+    }
+    for (p = 0u; p < 3u; p++) {
+        delete[] state[p];
+    }
+    return ok;
+}
+
+bool LorenzAttractorTest::TestSetOutput_Diagnostics() {
+    using namespace MARTe;
+    const char8 * const config = ""
+      "    Class = LorenzAttractorHelper"
+      "    Diagnostics = {"
+      "        Rate = 1"
+      "        Burst = 5"
+      "    }"
+      "    OutputSignals = {"
+      "        Signal1 = {"
+      "            DataSource = DDB"
+      "            Type = uint32"
+      "            Default = 0"
+      "        }"
+      "    }";
+
+    const ErrorManagement::ErrorProcessFunctionType previousFunction = ErrorManagement::errorMessageProcessFunction;
+    LorenzAttractorTestHelper::newValueReports = 0;
+    LorenzAttractorTestHelper::repeatedReports = 0;
+    LorenzAttractorTestHelper::rateLimitReports = 0;
+    LorenzAttractorTestHelper::setupReports = 0;
+    LorenzAttractorTestHelper::repeatedRecords = 0;
+    LorenzAttractorTestHelper::rateLimitedRecords = 0;
+    LorenzAttractorTestHelper::droppedRecords = 0;
+    ErrorManagement::SetErrorProcessFunction(&LorenzAttractorTestHelper::CountReports);
+
+    bool ok = LorenzAttractorTestHelper::ConfigureGAM(config);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    // The same value: a single record and a repeat count
+    uint32 i;
+    for (i = 0u; (i < 100u) && (ok); i++) {
+        uint32 value = 1234u;
+        ok = (LorenzAttractorTestHelper::SetOutput(gam, 0u, value) == ErrorManagement::NoError);
+    }
+    // A burst of different values: the records beyond the bucket are only counted
+    for (i = 0u; (i < 1000u) && (ok); i++) {
+        ok = (LorenzAttractorTestHelper::SetOutput(gam, 0u, i) == ErrorManagement::NoError);
+    }
+    uint32 value = 0u;
+    if (ok) {
+        ok = (gam->GetOutput(0u, value) && (value == 999u));
+    }
+    // Report everything which was queued or counted before counting
+    if (ok) {
+        gam->StopDiagnostics();
+    }
+    god->Purge();
+    ErrorManagement::SetErrorProcessFunction(previousFunction);
+
+    if (ok) {
+        // Each of the 2 Setup records and of the 1100 SetOutput records is reported, repeated, rate limited or dropped
+        const int32 accepted = LorenzAttractorTestHelper::setupReports + LorenzAttractorTestHelper::newValueReports;
+        ok = ((accepted + LorenzAttractorTestHelper::repeatedRecords + LorenzAttractorTestHelper::rateLimitedRecords
+                + LorenzAttractorTestHelper::droppedRecords) == 1102);
+        // The bucket holds Burst = 5 records and at Rate = 1 record per second at most one token is refilled during the messages
+        ok = (ok) && (accepted <= (5 + 1));
+    }
+    if (ok) {
+        ok = ((LorenzAttractorTestHelper::newValueReports >= 1) && (LorenzAttractorTestHelper::repeatedReports >= 1)
+                && (LorenzAttractorTestHelper::rateLimitReports >= 1));
+    }
+    return ok;
+}
+
+bool LorenzAttractorTest::TestSetOutput_DiagnosticsArray() {
+    using namespace MARTe;
+    const char8 * const config = ""
+      "    Class = LorenzAttractorHelper"
+      "    Diagnostics = {"
+      "        Rate = 1000"
+      "        Burst = 100"
+      "    }"
+      "    OutputSignals = {"
+      "        Signal1 = {"
+      "            DataSource = DDB"
+      "            Type = uint32"
+      "            NumberOfElements = 3"
+      "            Default = {0 0 0}"
+      "        }"
+      "    }";
+
+    const ErrorManagement::ErrorProcessFunctionType previousFunction = ErrorManagement::errorMessageProcessFunction;
+    LorenzAttractorTestHelper::newValueReports = 0;
+    LorenzAttractorTestHelper::repeatedReports = 0;
+    ErrorManagement::SetErrorProcessFunction(&LorenzAttractorTestHelper::CountReports);
+
+    bool ok = LorenzAttractorTestHelper::ConfigureGAM(config);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    // Only the last element changes in the third message: it is a new value, not a repetition
+    uint32 value[3] = { 1u, 2u, 3u };
+    uint32 m;
+    for (m = 0u; (m < 3u) && (ok); m++) {
+        if (m == 2u) {
+            value[2] = 4u;
+        }
+        ok = (LorenzAttractorTestHelper::SetOutput(gam, 0u, value) == ErrorManagement::NoError);
+    }
+    if (ok) {
+        gam->StopDiagnostics();
+    }
+    god->Purge();
+    ErrorManagement::SetErrorProcessFunction(previousFunction);
+    if (ok) {
+        ok = ((LorenzAttractorTestHelper::newValueReports == 2) && (LorenzAttractorTestHelper::repeatedReports == 1));
+    }
+    return ok;
+}
+
+bool LorenzAttractorTest::TestExecute_NoPageFaults() {
+    using namespace MARTe;
+    const uint32 numberOfNodes = 8192u;
+    StreamString config;
+    bool ok = config.Printf("%s", "Class = LorenzAttractorHelper TimeStep = 0.001 NumberOfSubSteps = 10 NumberOfWorkers = 2 RealTimeCPUs = 0x1"
+                            " Lyapunov = { TimeConstant = 1.0 }"
+                            " Events = { LobeSwitches = 1 Planes = { Poincare = { Normal = {0.0 0.0 1.0} Offset = 27.0 } } }"
+                            " OutputSignals = {");
+    const char8 * const names[3] = { "X", "Y", "Z" };
+    uint32 c;
+    for (c = 0u; (c < 3u) && (ok); c++) {
+        ok = config.Printf(" %s = { DataSource = DDB Type = float64 NumberOfElements = %u Default = {", names[c], numberOfNodes);
+        uint32 i;
+        for (i = 0u; (i < numberOfNodes) && (ok); i++) {
+            const float64 value = (c == 2u) ? (20.0) : (1.0 + (0.001 * static_cast<float64>(i)));
+            ok = config.Printf(" %f", value);
+        }
+        ok = (ok) && (config.Printf("%s", " } }"));
+    }
+    ok = (ok) && (config.Printf(" Lyapunov = { DataSource = DDB Type = float64 NumberOfElements = %u }", numberOfNodes));
+    ok = (ok) && (config.Printf("%s", " EventCount = { DataSource = DDB Type = uint32 }"
+                                " EventTimes = { DataSource = DDB Type = float64 NumberOfElements = 64 }"
+                                " EventNodes = { DataSource = DDB Type = uint32 NumberOfElements = 64 }"
+                                " EventTypes = { DataSource = DDB Type = int32 NumberOfElements = 64 } }"));
+    if (ok) {
+        ok = LorenzAttractorTestHelper::ConfigureGAM(config.Buffer());
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    // The log thread formats (and allocates) concurrently: report the Setup values and stop it
+    if (ok) {
+        gam->StopDiagnostics();
+    }
+    // As a real-time application would, map and lock the code and the stacks which are not part of the arena
+    if (ok) {
+        ok = (mlockall(MCL_CURRENT) == 0);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "mlockall failed (see RLIMIT_MEMLOCK)");
+        }
+    }
+    // The faults of all the threads (the caller and the workers) from the first cycle after Setup
+    struct rusage before;
+    struct rusage after;
+    if (ok) {
+        ok = (getrusage(RUSAGE_SELF, &before) == 0);
+    }
+    uint32 cycle;
+    for (cycle = 0u; (cycle < 100u) && (ok); cycle++) {
+        ok = gam->Execute();
+    }
+    if (ok) {
+        ok = (getrusage(RUSAGE_SELF, &after) == 0);
+    }
+    (void) munlockall();
+    if (ok) {
+        const long faults = (after.ru_minflt - before.ru_minflt) + (after.ru_majflt - before.ru_majflt);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%d page faults in 100 cycles", static_cast<int32>(faults));
+        ok = (faults == 0);
+    }
+    god->Purge();
+    return ok;
+}
+
+bool LorenzAttractorTest::TestInitialConditions_File() {
+    using namespace MARTe;
+    const char8 * const fileName = "/tmp/LorenzAttractorInitialConditionsTest.bin";
+    // Node 0 below the pitchfork bifurcation (decays to the origin), node 1 chaotic; Y in float32
+    const float64 x[2] = { 1.5, -2.5 };
+    const float32 y[2] = { 0.5F, 1.25F };
+    const float64 z[2] = { 3.0, 20.0 };
+    const float64 rho[2] = { 0.5, 28.0 };
+    const char8 * const names[4] = { "X", "Y", "Z", "Rho" };
+    const uint32 types[4] = { LorenzArrayFile::Float64Field, LorenzArrayFile::Float32Field, LorenzArrayFile::Float64Field, LorenzArrayFile::Float64Field };
+    const void * const arrays[4] = { &x[0], &y[0], &z[0], &rho[0] };
+    bool ok = LorenzArrayFile::Write(fileName, 2u, 4u, &names[0], &types[0], &arrays[0]);
+    StreamString initialConditions;
+    if (ok) {
+        ok = initialConditions.Printf("Source = File File = \"%s\"", fileName);
+    }
+    if (ok) {
+        ok = LorenzAttractorTestHelper::ConfigureInitialConditions(initialConditions.Buffer(), 2u);
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    // Published at Setup
+    uint32 i;
+    for (i = 0u; (i < 2u) && (ok); i++) {
+        float64 values[3] = { 0.0, 0.0, 0.0 };
+        ok = (gam->GetOutput(0u, values[0], i) && gam->GetOutput(1u, values[1], i) && gam->GetOutput(2u, values[2], i));
+        if (ok) {
+            ok = ((values[0] == x[i]) && (values[1] == static_cast<float64>(y[i])) && (values[2] == z[i]));
+        }
+    }
+    // 20 s
+    uint32 cycle;
+    for (cycle = 0u; (cycle < 200u) && (ok); cycle++) {
+        ok = gam->Execute();
+    }
+    float64 x0 = 1.0;
+    float64 z1 = 0.0;
+    if (ok) {
+        ok = (gam->GetOutput(0u, x0, 0u) && gam->GetOutput(2u, z1, 1u));
+    }
+    if (ok) {
+        ok = ((LorenzAttractorTestHelper::IsClose(x0, 0.0, 1e-3)) && (z1 > 1.0));
+    }
+    god->Purge();
+    return ok;
+}
+
+bool LorenzAttractorTest::TestInitialConditions_Generators() {
+    using namespace MARTe;
+    const uint32 numberOfNodes = 10000u;
+    bool ok = LorenzAttractorTestHelper::ConfigureInitialConditions("Source = UniformBox Seed = 7 Minimum = {-20.0 -25.0 0.0} Maximum = {20.0 25.0 50.0}",
+                                                                     numberOfNodes);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorHelper> gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    // Uniform in [a, b]: mean (a + b) / 2 and standard deviation (b - a) / sqrt(12)
+    const float64 minimum[3] = { -20.0, -25.0, 0.0 };
+    const float64 maximum[3] = { 20.0, 25.0, 50.0 };
+    uint32 c;
+    for (c = 0u; (c < 3u) && (ok); c++) {
+        float64 mean = 0.0;
+        float64 deviation = 0.0;
+        ok = LorenzAttractorTestHelper::GetStatistics(gam, c, numberOfNodes, minimum[c], maximum[c], mean, deviation);
+        const float64 expectedDeviation = (maximum[c] - minimum[c]) / sqrt(12.0);
+        if (ok) {
+            ok = ((LorenzAttractorTestHelper::IsClose(mean, (minimum[c] + maximum[c]) / 2.0, 0.05 * expectedDeviation))
+                    && (LorenzAttractorTestHelper::IsClose(deviation, expectedDeviation, 0.05 * expectedDeviation)));
+        }
+    }
+    god->Purge();
+    if (ok) {
+        ok = LorenzAttractorTestHelper::ConfigureInitialConditions("Source = GaussianBall Center = {1.0 2.0 25.0} StandardDeviation = 5.0", numberOfNodes);
+    }
+    gam = god->Find("Test.Functions.LorenzAttractor");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    const float64 center[3] = { 1.0, 2.0, 25.0 };
+    for (c = 0u; (c < 3u) && (ok); c++) {
+        float64 mean = 0.0;
+        float64 deviation = 0.0;
+        ok = LorenzAttractorTestHelper::GetStatistics(gam, c, numberOfNodes, center[c] - 50.0, center[c] + 50.0, mean, deviation);
+        if (ok) {
+            ok = ((LorenzAttractorTestHelper::IsClose(mean, center[c], 0.25)) && (LorenzAttractorTestHelper::IsClose(deviation, 5.0, 0.25)));
+        }
+    }
+    god->Purge();
+    return ok;
+}
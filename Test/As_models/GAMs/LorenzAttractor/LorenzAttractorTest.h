@@ -75,6 +75,90 @@ public:
      */
     bool TestSetup();
 
+    /**
+     * @brief Tests the Execute() method integrating uncoupled nodes against a reference RK4 implementation.
+     */
+    bool TestExecute_Model();
+
+    /**
+     * @brief Tests the Execute() method integrating a reordered coupled network (with workers) against a reference RK4 implementation.
+     */
+    bool TestExecute_Coupled();
+
+    /**
+     * @brief Tests that Initialise() fails if the coupling Rows and Columns have a different number of elements.
+     */
+    bool TestInitialise_InvalidCoupling();
+
+    /**
+     * @brief Tests that Initialise() fails if the Lyapunov estimator is configured on a coupled network.
+     */
+    bool TestInitialise_LyapunovCoupled();
+
+    /**
+     * @brief Tests that the lobe switches and plane crossings are published with the refined time, node and direction.
+     */
+    bool TestExecute_Events();
+
+    /**
+     * @brief Tests that the earliest events are published when a partition detects more events than the capacity in one step.
+     */
+    bool TestExecute_EventsOverflow();
+
+    /**
+     * @brief Tests that Reconfigure changes the number of nodes and the integrator at the state change.
+     */
+    bool TestReconfigure();
+
+    /**
+     * @brief Tests that the online estimate of the largest Lyapunov exponent converges for two independent nodes.
+     */
+    bool TestExecute_Lyapunov();
+
+    /**
+     * @brief Tests that a background sweep over rho writes the expected statistics.
+     */
+    bool TestSweep();
+
+    /**
+     * @brief Tests that CancelSweep stops a sweep.
+     */
+    bool TestSweep_Cancel();
+
+    /**
+     * @brief Tests that Initialise() fails if the SweepCPUs could share a CPU with the real-time thread or the workers.
+     */
+    bool TestInitialise_InvalidSweepCPUs();
+
+    /**
+     * @brief Tests that the Float32 and Float32Compensated states stay within a fixed bound of the Float64 state over 1 s.
+     */
+    bool TestExecute_Precision();
+
+    /**
+     * @brief Tests that bursts of SetOutput messages are deduplicated and rate-limited by the diagnostics log.
+     */
+    bool TestSetOutput_Diagnostics();
+
+    /**
+     * @brief Tests that a SetOutput which only changes an element beyond the first is not reported as a repetition.
+     */
+    bool TestSetOutput_DiagnosticsArray();
+
+    /**
+     * @brief Tests that Execute takes no page faults, in any thread, from the first cycle (workers, Lyapunov and events enabled).
+     */
+    bool TestExecute_NoPageFaults();
+
+    /**
+     * @brief Tests the initial conditions and per-node parameters loaded from a LorenzArrayFile.
+     */
+    bool TestInitialConditions_File();
+
+    /**
+     * @brief Tests the statistics of the UniformBox and GaussianBall initial conditions.
+     */
+    bool TestInitialConditions_Generators();
 
 };
 
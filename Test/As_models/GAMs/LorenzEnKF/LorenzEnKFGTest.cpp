@@ -0,0 +1,78 @@
+/**
+ * @file LorenzEnKFGTest.cpp
+ * @brief Source file for class LorenzEnKFGTest
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This source file contains the definition of all the methods for
+ * the class LorenzEnKFGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "gtest/gtest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "LorenzEnKF.h"
+#include "LorenzEnKFTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(LorenzEnKFGTest,TestConstructor) {
+    LorenzEnKFTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(LorenzEnKFGTest,TestInitialise_InvalidMembers) {
+    LorenzEnKFTest test;
+    ASSERT_TRUE(test.TestInitialise_InvalidMembers());
+}
+
+TEST(LorenzEnKFGTest,TestSetup_NoMeasurements) {
+    LorenzEnKFTest test;
+    ASSERT_TRUE(test.TestSetup_NoMeasurements());
+}
+
+TEST(LorenzEnKFGTest,TestExecute_Reference) {
+    LorenzEnKFTest test;
+    ASSERT_TRUE(test.TestExecute_Reference());
+}
+
+TEST(LorenzEnKFGTest,TestExecute_PartialReference) {
+    LorenzEnKFTest test;
+    ASSERT_TRUE(test.TestExecute_PartialReference());
+}
+
+TEST(LorenzEnKFGTest,TestExecute_Tracking) {
+    LorenzEnKFTest test;
+    ASSERT_TRUE(test.TestExecute_Tracking());
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
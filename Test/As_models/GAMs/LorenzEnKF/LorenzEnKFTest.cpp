@@ -0,0 +1,435 @@
+/**
+ * @file LorenzEnKFTest.cpp
+ * @brief Source file for class LorenzEnKFTest
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This source file contains the definition of all the methods for
+ * the class LorenzEnKFTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "GAM.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+#include "LorenzEnKF.h"
+#include "LorenzEnKFTest.h"
+#include "LorenzRandom.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+class LorenzEnKFHelper: public MARTe::LorenzEnKF {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    LorenzEnKFHelper() : MARTe::LorenzEnKF() {};
+    virtual ~LorenzEnKFHelper() {};
+
+    void SetInput(const MARTe::uint32 signalIndex, const MARTe::float64 value) {
+        *static_cast<MARTe::float64 *>(GetInputSignalMemory(signalIndex)) = value;
+    }
+
+    MARTe::float64 GetOutput(const MARTe::uint32 signalIndex, const MARTe::uint32 index) {
+        return static_cast<MARTe::float64 *>(GetOutputSignalMemory(signalIndex))[index];
+    }
+};
+
+CLASS_REGISTER(LorenzEnKFHelper, "1.0")
+
+namespace LorenzEnKFTestHelper {
+
+/**
+ * Configures an application where the Filter measures the components flagged in \a measured.
+ * The measurements are produced by a constant LorenzAttractor and overwritten by the tests.
+ */
+static bool ConfigureFilter(const MARTe::char8 * const filterParameters, const bool (&measured)[3]) {
+    using namespace MARTe;
+    const char8 * const names[3] = { "X", "Y", "Z" };
+    StreamString config = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +Measurements = {"
+        "            Class = LorenzAttractor"
+        "            OutputSignals = {";
+    uint32 c;
+    for (c = 0u; c < 3u; c++) {
+        config += "                ";
+        config += names[c];
+        config += " = { DataSource = DDB Type = float64 Default = 0.0 }";
+    }
+    config += ""
+        "            }"
+        "        }"
+        "        +Filter = {"
+        "            Class = LorenzEnKFHelper"
+        "            TimeStep = 0.01"
+        "            NumberOfSubSteps = 10"
+        "            Seed = 3"
+        "            InitialMean = { 1.0 1.0 1.0 }"
+        "            InitialSpread = { 1.0 1.0 1.0 }"
+        "            MeasurementNoise = { 0.5 0.5 0.5 }";
+    config += filterParameters;
+    config += ""
+        "            InputSignals = {";
+    for (c = 0u; c < 3u; c++) {
+        if (measured[c]) {
+            config += "                ";
+            config += names[c];
+            config += " = { DataSource = DDB Type = float64 }";
+        }
+    }
+    config += ""
+        "            }"
+        "            OutputSignals = {"
+        "                Estimate = { DataSource = DDB Type = float64 NumberOfElements = 3 }"
+        "                Covariance = { DataSource = DDB Type = float64 NumberOfElements = 9 }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB"
+        "        +DDB = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +Running = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = { Measurements Filter }"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+    ConfigurationDatabase cdb;
+    StreamString err;
+    (void) config.Seek(0LLU);
+    StandardParser parser(config, cdb, &err);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ok = parser.Parse();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+static inline bool IsClose(const MARTe::float64 value, const MARTe::float64 expected, const MARTe::float64 tolerance) {
+    MARTe::float64 difference = value - expected;
+    return ((difference < tolerance) && (difference > -tolerance));
+}
+
+/**
+ * Reference RK4 step of a single Lorenz system.
+ */
+static void ReferenceStep(MARTe::float64 (&s)[3], const MARTe::float64 h) {
+    using namespace MARTe;
+    const float64 sigma = 10.0;
+    const float64 rho = 28.0;
+    const float64 beta = 8.0 / 3.0;
+    const float64 advance[4] = { 0.0, 0.5, 0.5, 1.0 };
+    float64 d[4][3];
+    float64 t[3];
+    uint32 c;
+    uint32 stage;
+    for (stage = 0u; stage < 4u; stage++) {
+        for (c = 0u; c < 3u; c++) {
+            t[c] = (stage == 0u) ? (s[c]) : (s[c] + (advance[stage] * h * d[stage - 1u][c]));
+        }
+        d[stage][0] = sigma * (t[1] - t[0]);
+        d[stage][1] = (t[0] * (rho - t[2])) - t[1];
+        d[stage][2] = (t[0] * t[1]) - (beta * t[2]);
+    }
+    for (c = 0u; c < 3u; c++) {
+        s[c] += (h / 6.0) * (d[0][c] + (2.0 * d[1][c]) + (2.0 * d[2][c]) + d[3][c]);
+    }
+}
+
+/**
+ * Reference ensemble Kalman filter cycle: member by member forecast and textbook Kalman update of the ensemble
+ * mean and covariance (P = (I - K H) P with K = P H^T (H P H^T + R)^-1, the inverse computed by Gauss-Jordan).
+ */
+static void ReferenceCycle(MARTe::float64 (*members)[3], const MARTe::uint32 numberOfMembers, const MARTe::float64 timeStep,
+                           const MARTe::uint32 numberOfSubSteps, const bool (&measured)[3], const MARTe::float64 (&measurement)[3],
+                           const MARTe::float64 (&noise)[3], const MARTe::float64 inflation, MARTe::float64 (&mean)[3],
+                           MARTe::float64 (&covariance)[3][3]) {
+    using namespace MARTe;
+    uint32 i;
+    uint32 r;
+    uint32 c;
+    uint32 k;
+    for (i = 0u; i < numberOfMembers; i++) {
+        uint32 step;
+        for (step = 0u; step < numberOfSubSteps; step++) {
+            ReferenceStep(members[i], timeStep);
+        }
+    }
+    // Forecast mean and (inflated) covariance
+    for (c = 0u; c < 3u; c++) {
+        mean[c] = 0.0;
+        for (i = 0u; i < numberOfMembers; i++) {
+            mean[c] += members[i][c] / numberOfMembers;
+        }
+    }
+    float64 p[3][3];
+    for (r = 0u; r < 3u; r++) {
+        for (c = 0u; c < 3u; c++) {
+            p[r][c] = 0.0;
+            for (i = 0u; i < numberOfMembers; i++) {
+                p[r][c] += (members[i][r] - mean[r]) * (members[i][c] - mean[c]);
+            }
+            p[r][c] *= (inflation * inflation) / (numberOfMembers - 1u);
+        }
+    }
+    uint32 index[3];
+    uint32 m = 0u;
+    for (c = 0u; c < 3u; c++) {
+        if (measured[c]) {
+            index[m] = c;
+            m++;
+        }
+    }
+    // [S | I] -> [I | S^-1] with S = H P H^T + R
+    float64 s[3][6];
+    for (r = 0u; r < m; r++) {
+        for (c = 0u; c < m; c++) {
+            s[r][c] = p[index[r]][index[c]] + ((r == c) ? (noise[index[r]] * noise[index[r]]) : (0.0));
+            s[r][m + c] = (r == c) ? (1.0) : (0.0);
+        }
+    }
+    for (k = 0u; k < m; k++) {
+        const float64 pivot = s[k][k];
+        for (c = 0u; c < (2u * m); c++) {
+            s[k][c] /= pivot;
+        }
+        for (r = 0u; r < m; r++) {
+            if (r != k) {
+                const float64 factor = s[r][k];
+                for (c = 0u; c < (2u * m); c++) {
+                    s[r][c] -= factor * s[k][c];
+                }
+            }
+        }
+    }
+    float64 gain[3][3];
+    for (r = 0u; r < 3u; r++) {
+        for (c = 0u; c < m; c++) {
+            gain[r][c] = 0.0;
+            for (k = 0u; k < m; k++) {
+                gain[r][c] += p[r][index[k]] * s[k][m + c];
+            }
+        }
+    }
+    float64 innovation[3];
+    for (k = 0u; k < m; k++) {
+        innovation[k] = measurement[index[k]] - mean[index[k]];
+    }
+    for (r = 0u; r < 3u; r++) {
+        for (k = 0u; k < m; k++) {
+            mean[r] += gain[r][k] * innovation[k];
+        }
+    }
+    for (r = 0u; r < 3u; r++) {
+        for (c = 0u; c < 3u; c++) {
+            covariance[r][c] = p[r][c];
+            for (k = 0u; k < m; k++) {
+                covariance[r][c] -= gain[r][k] * p[index[k]][c];
+            }
+        }
+    }
+}
+
+/**
+ * Runs one cycle of a 16 member filter and compares the estimate and the covariance with ReferenceCycle.
+ */
+static bool CompareWithReference(const MARTe::char8 * const filterParameters, const MARTe::float64 inflation, const bool (&measured)[3]) {
+    using namespace MARTe;
+    const uint32 numberOfMembers = 16u;
+    const float64 measurement[3] = { 1.5, 2.0, 2.5 };
+    const float64 noise[3] = { 0.5, 0.5, 0.5 };
+    bool ok = ConfigureFilter(filterParameters, measured);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzEnKFHelper> gam = god->Find("Test.Functions.Filter");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        uint32 signalIndex = 0u;
+        uint32 c;
+        for (c = 0u; c < 3u; c++) {
+            if (measured[c]) {
+                gam->SetInput(signalIndex, measurement[c]);
+                signalIndex++;
+            }
+        }
+        ok = gam->Execute();
+    }
+    // Same initial ensemble as the GAM: member by member, x, y, z
+    float64 members[numberOfMembers][3];
+    LorenzRandom random(3u);
+    uint32 i;
+    for (i = 0u; i < numberOfMembers; i++) {
+        uint32 c;
+        for (c = 0u; c < 3u; c++) {
+            members[i][c] = 1.0 + random.Gaussian();
+        }
+    }
+    float64 mean[3];
+    float64 covariance[3][3];
+    ReferenceCycle(members, numberOfMembers, 0.01, 10u, measured, measurement, noise, inflation, mean, covariance);
+    uint32 r;
+    for (r = 0u; (r < 3u) && (ok); r++) {
+        ok = IsClose(gam->GetOutput(0u, r), mean[r], 1e-9);
+        uint32 c;
+        for (c = 0u; (c < 3u) && (ok); c++) {
+            ok = IsClose(gam->GetOutput(1u, (3u * r) + c), covariance[r][c], 1e-9);
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+LorenzEnKFTest::LorenzEnKFTest() {
+}
+
+LorenzEnKFTest::~LorenzEnKFTest() {
+}
+
+bool LorenzEnKFTest::TestConstructor() {
+    using namespace MARTe;
+    LorenzEnKF gam;
+
+    bool ok = (gam.GetNumberOfInputSignals() == 0u) && (gam.GetNumberOfOutputSignals() == 0u);
+
+    return ok;
+}
+
+bool LorenzEnKFTest::TestInitialise_InvalidMembers() {
+    using namespace MARTe;
+    LorenzEnKF gam;
+    ConfigurationDatabase cdb;
+    float64 noise[3] = { 0.5, 0.5, 0.5 };
+    bool ok = (cdb.Write("TimeStep", 0.01) && cdb.Write("NumberOfMembers", 1u) && cdb.Write("MeasurementNoise", noise));
+    if (ok) {
+        ok = !gam.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool LorenzEnKFTest::TestSetup_NoMeasurements() {
+    const bool measured[3] = { false, false, false };
+    bool ok = !LorenzEnKFTestHelper::ConfigureFilter("NumberOfMembers = 16", measured);
+    MARTe::ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool LorenzEnKFTest::TestExecute_Reference() {
+    const bool measured[3] = { true, true, true };
+    return LorenzEnKFTestHelper::CompareWithReference("NumberOfMembers = 16", 1.0, measured);
+}
+
+bool LorenzEnKFTest::TestExecute_PartialReference() {
+    const bool measured[3] = { true, false, true };
+    return LorenzEnKFTestHelper::CompareWithReference("NumberOfMembers = 16 Inflation = 1.1", 1.1, measured);
+}
+
+bool LorenzEnKFTest::TestExecute_Tracking() {
+    using namespace MARTe;
+    const bool measured[3] = { true, false, false };
+    bool ok = LorenzEnKFTestHelper::ConfigureFilter("NumberOfMembers = 100 Inflation = 1.05", measured);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzEnKFHelper> gam = god->Find("Test.Functions.Filter");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    // The truth starts away from the prior mean and only noisy X measurements are given
+    float64 truth[3] = { 1.5, -0.5, 2.0 };
+    LorenzRandom noise(99u);
+    float64 squaredError[3] = { 0.0, 0.0, 0.0 };
+    const uint32 numberOfCycles = 400u;
+    uint32 cycle;
+    for (cycle = 0u; (cycle < numberOfCycles) && (ok); cycle++) {
+        uint32 step;
+        for (step = 0u; step < 10u; step++) {
+            LorenzEnKFTestHelper::ReferenceStep(truth, 0.01);
+        }
+        gam->SetInput(0u, truth[0] + (0.5 * noise.Gaussian()));
+        ok = gam->Execute();
+        if (cycle >= (numberOfCycles / 2u)) {
+            uint32 c;
+            for (c = 0u; c < 3u; c++) {
+                const float64 error = gam->GetOutput(0u, c) - truth[c];
+                squaredError[c] += error * error;
+            }
+        }
+    }
+    // The attractor spans ~40 units in z: without the analysis the error would be of the order of 10
+    uint32 c;
+    for (c = 0u; (c < 3u) && (ok); c++) {
+        ok = (sqrt(squaredError[c] / (numberOfCycles / 2u)) < 1.0);
+    }
+    god->Purge();
+    return ok;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file LorenzEnKFTest.h
+ * @brief Header file for class LorenzEnKFTest
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details This header file contains the declaration of the class
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LORENZENKFTEST_H_
+#define LORENZENKFTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the LorenzEnKF public methods.
+ */
+class LorenzEnKFTest {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    LorenzEnKFTest();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~LorenzEnKFTest();
+
+    /**
+     * @brief Tests the default constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that Initialise() fails with less than two members.
+     */
+    bool TestInitialise_InvalidMembers();
+
+    /**
+     * @brief Tests that Setup() fails if no measurement is configured.
+     */
+    bool TestSetup_NoMeasurements();
+
+    /**
+     * @brief Compares one cycle with all the components measured against a reference Kalman update.
+     */
+    bool TestExecute_Reference();
+
+    /**
+     * @brief Compares one cycle with X and Z measured and inflation against a reference Kalman update.
+     */
+    bool TestExecute_PartialReference();
+
+    /**
+     * @brief Tests that the unmeasured components are tracked from noisy X measurements.
+     */
+    bool TestExecute_Tracking();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LORENZENKFTEST_H_ */
@@ -0,0 +1,272 @@
+/**
+ * @file LorenzAttractorBenchmark.cpp
+ * @brief Source file for the LorenzAttractor precision benchmark
+ * @date 2026-10-19
+ * @author Adam V Stephen
+ */
+
+/*
+ * @copyright United Kingdom Atomic Energy Authority
+ *
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ */
+
+/*
+ * @details Measures, for the Float64, Float32 and Float32Compensated precisions, the Execute() time per node and step
+ * of a LorenzAttractor integrating uncoupled nodes and, for the single precisions, the divergence time: the mean model
+ * time at which a node departs by more than DivergenceThreshold (Euclidean distance) from the same node integrated
+ * with Float64. It is not part of the GTest suite, whose results shall not depend on the load of the machine.
+ *
+ * Usage: LorenzAttractorBenchmark.ex [NumberOfNodes [NumberOfCycles]] (defaults: 4096 nodes and 1000 cycles of
+ * 10 steps of 1 ms; the divergence is followed for at most MaximumDivergenceTime).
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ConfigurationDatabase.h"
+#include "ErrorManagement.h"
+#include "HighResolutionTimer.h"
+#include "ObjectRegistryDatabase.h"
+#include "RealTimeApplication.h"
+#include "StandardParser.h"
+#include "StreamString.h"
+#include "LorenzAttractor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Gives access to the X, Y and Z output signals (the first three signals).
+ */
+class LorenzAttractorProbe: public MARTe::LorenzAttractor {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    LorenzAttractorProbe() : MARTe::LorenzAttractor() {};
+    virtual ~LorenzAttractorProbe() {};
+    const MARTe::float64 *GetState(const MARTe::uint32 component) {
+        return static_cast<const MARTe::float64 *>(GetOutputSignalMemory(component));
+    }
+};
+
+CLASS_REGISTER(LorenzAttractorProbe, "1.0")
+
+namespace {
+
+/**
+ * Model time of a cycle in seconds (10 steps of 1 ms).
+ */
+const MARTe::float64 CycleTime = 0.01;
+
+/**
+ * Distance to the Float64 trajectory at which a node is considered to have diverged.
+ */
+const MARTe::float64 DivergenceThreshold = 1.0;
+
+/**
+ * Model time after which the nodes which did not diverge are counted as diverging then.
+ */
+const MARTe::float64 MaximumDivergenceTime = 100.0;
+
+void BenchmarkErrorProcessFunction(const MARTe::ErrorManagement::ErrorInformation &errorInfo, const char * const errorDescription) {
+    MARTe::StreamString errorCodeStr;
+    MARTe::ErrorManagement::ErrorCodeToStream(errorInfo.header.errorType, errorCodeStr);
+    printf("[%s - %s:%d]: %s\n", errorCodeStr.Buffer(), errorInfo.fileName, errorInfo.header.lineNumber, errorDescription);
+}
+
+/**
+ * @brief Configures a RealTimeApplication with two LorenzAttractorProbe of numberOfNodes nodes, starting from the same
+ * state: Reference, with Precision = Float64, and Candidate, with the given Precision.
+ */
+bool Configure(const MARTe::char8 * const precision, const MARTe::uint32 numberOfNodes) {
+    using namespace MARTe;
+    StreamString config;
+    bool ok = config.Printf("%s", "$Benchmark = { Class = RealTimeApplication +Functions = { Class = ReferenceContainer");
+    const char8 * const gamNames[2] = { "Reference", "Candidate" };
+    const char8 * const gamPrecisions[2] = { "Float64", precision };
+    uint32 g;
+    for (g = 0u; (g < 2u) && (ok); g++) {
+        ok = config.Printf(" +%s = { Class = LorenzAttractorProbe TimeStep = 0.001 NumberOfSubSteps = 10 Precision = %s OutputSignals = {",
+                           gamNames[g], gamPrecisions[g]);
+        const char8 * const names[3] = { "X", "Y", "Z" };
+        uint32 c;
+        for (c = 0u; (c < 3u) && (ok); c++) {
+            // Each GAM produces its own X, Y and Z in the DDB
+            ok = config.Printf(" %s = { DataSource = DDB Alias = %s%s Type = float64 NumberOfElements = %u Default = {", names[c], gamNames[g], names[c],
+                               numberOfNodes);
+            uint32 i;
+            for (i = 0u; (i < numberOfNodes) && (ok); i++) {
+                const float64 value = (c == 0u) ? (1.0 + (0.001 * static_cast<float64>(i))) : (1.0);
+                ok = config.Printf(" %f", value);
+            }
+            ok = (ok) && (config.Printf("%s", " } }"));
+        }
+        ok = (ok) && (config.Printf("%s", " } }"));
+    }
+    ok = (ok) && (config.Printf("%s", " }"
+                                " +Data = { Class = ReferenceContainer DefaultDataSource = DDB +DDB = { Class = GAMDataSource }"
+                                " +Timings = { Class = TimingDataSource } }"
+                                " +States = { Class = ReferenceContainer +Running = { Class = RealTimeState +Threads = {"
+                                " Class = ReferenceContainer +Thread = { Class = RealTimeThread Functions = { Reference Candidate } } } } }"
+                                " +Scheduler = { Class = GAMScheduler TimingDataSource = Timings } }"));
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = config.Seek(0LLU);
+    }
+    if (ok) {
+        StandardParser parser(config, cdb);
+        ok = parser.Parse();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Benchmark");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+/**
+ * @brief Times numberOfCycles Execute() calls of the Candidate (after numberOfCycles / 10 warm-up cycles) and returns
+ * the time per node and step.
+ */
+bool Time(const MARTe::char8 * const precision, const MARTe::uint32 numberOfNodes, const MARTe::uint32 numberOfCycles,
+          MARTe::float64 &nanosecondsPerStep) {
+    using namespace MARTe;
+    bool ok = Configure(precision, numberOfNodes);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorProbe> gam;
+    if (ok) {
+        gam = god->Find("Benchmark.Functions.Candidate");
+        ok = gam.IsValid();
+    }
+    uint32 cycle;
+    for (cycle = 0u; (cycle < (numberOfCycles / 10u)) && (ok); cycle++) {
+        ok = gam->Execute();
+    }
+    const uint64 start = HighResolutionTimer::Counter();
+    for (cycle = 0u; (cycle < numberOfCycles) && (ok); cycle++) {
+        ok = gam->Execute();
+    }
+    const uint64 ticks = HighResolutionTimer::Counter() - start;
+    nanosecondsPerStep = (static_cast<float64>(ticks) * HighResolutionTimer::Period() * 1e9)
+            / (static_cast<float64>(numberOfCycles) * 10.0 * static_cast<float64>(numberOfNodes));
+    god->Purge();
+    return ok;
+}
+
+/**
+ * @brief Integrates the Reference and the Candidate side by side and returns the mean model time at which the nodes
+ * depart from the Reference by more than DivergenceThreshold, and the number of nodes which did before MaximumDivergenceTime.
+ */
+bool Diverge(const MARTe::char8 * const precision, const MARTe::uint32 numberOfNodes, MARTe::float64 &divergenceTime,
+             MARTe::uint32 &numberOfDiverged) {
+    using namespace MARTe;
+    bool ok = Configure(precision, numberOfNodes);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<LorenzAttractorProbe> reference;
+    ReferenceT<LorenzAttractorProbe> candidate;
+    if (ok) {
+        reference = god->Find("Benchmark.Functions.Reference");
+        candidate = god->Find("Benchmark.Functions.Candidate");
+        ok = ((reference.IsValid()) && (candidate.IsValid()));
+    }
+    float64 *departure = new float64[numberOfNodes];
+    uint32 i;
+    for (i = 0u; i < numberOfNodes; i++) {
+        departure[i] = MaximumDivergenceTime;
+    }
+    numberOfDiverged = 0u;
+    const uint32 numberOfCycles = static_cast<uint32>(MaximumDivergenceTime / CycleTime);
+    uint32 cycle;
+    for (cycle = 0u; (cycle < numberOfCycles) && (numberOfDiverged < numberOfNodes) && (ok); cycle++) {
+        ok = ((reference->Execute()) && (candidate->Execute()));
+        for (i = 0u; (i < numberOfNodes) && (ok); i++) {
+            if (departure[i] >= MaximumDivergenceTime) {
+                float64 distance = 0.0;
+                uint32 c;
+                for (c = 0u; c < 3u; c++) {
+                    const float64 delta = candidate->GetState(c)[i] - reference->GetState(c)[i];
+                    distance += delta * delta;
+                }
+                if (sqrt(distance) > DivergenceThreshold) {
+                    departure[i] = CycleTime * static_cast<float64>(cycle + 1u);
+                    numberOfDiverged++;
+                }
+            }
+        }
+    }
+    divergenceTime = 0.0;
+    for (i = 0u; i < numberOfNodes; i++) {
+        divergenceTime += departure[i];
+    }
+    divergenceTime /= static_cast<float64>(numberOfNodes);
+    delete[] departure;
+    god->Purge();
+    return ok;
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+int main(int argc, char **argv) {
+    using namespace MARTe;
+    ErrorManagement::SetErrorProcessFunction(&BenchmarkErrorProcessFunction);
+    uint32 numberOfNodes = 4096u;
+    uint32 numberOfCycles = 1000u;
+    if (argc > 1) {
+        numberOfNodes = static_cast<uint32>(atoi(argv[1]));
+    }
+    if (argc > 2) {
+        numberOfCycles = static_cast<uint32>(atoi(argv[2]));
+    }
+    bool ok = ((numberOfNodes > 0u) && (numberOfCycles > 0u));
+    const char8 * const precisions[3] = { "Float64", "Float32", "Float32Compensated" };
+    uint32 p;
+    for (p = 0u; (p < 3u) && (ok); p++) {
+        float64 nanosecondsPerStep = 0.0;
+        ok = Time(precisions[p], numberOfNodes, numberOfCycles, nanosecondsPerStep);
+        if ((ok) && (p == 0u)) {
+            printf("%-20s %u nodes: %f ns per node and step (reference)\n", precisions[p], numberOfNodes, nanosecondsPerStep);
+        }
+        if ((ok) && (p > 0u)) {
+            float64 divergenceTime = 0.0;
+            uint32 numberOfDiverged = 0u;
+            ok = Diverge(precisions[p], numberOfNodes, divergenceTime, numberOfDiverged);
+            if (ok) {
+                printf("%-20s %u nodes: %f ns per node and step, mean divergence from Float64 at t = %f s (%u nodes diverged within %f s)\n",
+                       precisions[p], numberOfNodes, nanosecondsPerStep, divergenceTime, numberOfDiverged, MaximumDivergenceTime);
+            }
+        }
+    }
+    return (ok) ? (0) : (1);
+}